@@ -0,0 +1,143 @@
+#include "batch.hpp"
+
+/* -------------------------- Batch Definitions ------------------------- */
+
+/**
+ * Sets or clears the validity of the given row in a validity bitmap.
+ */
+static inline void setValid(uint32_t * bitmap, size_t row, bool valid)
+{
+    uint32_t bit = (uint32_t) 1 << (row % 32);
+
+    if (valid)
+        bitmap[row / 32] |= bit;
+    else
+        bitmap[row / 32] &= ~bit;
+}
+
+/**
+ * Writes the given field to a row of a column. If the field is invalid, the row is set to the default
+ * value of the column and marked as invalid.
+ */
+template <typename T>
+static inline void setColumn(T * column, uint32_t * bitmap, size_t row, Field<T> field)
+{
+    const T * const value = field.getValue();
+
+    column[row] = value != NULL ? *value : T();
+    setValid(bitmap, row, value != NULL);
+}
+
+/**
+ * Converts the time of a `TIME` sentence ("HHMMSS.SS") to milliseconds since midnight.
+ *
+ * @returns The time of day in milliseconds, or an invalid field if the time is invalid.
+ */
+static Field<uint32_t> timeOfDay(Field<std::string> time)
+{
+    const std::string * const value = time.getValue();
+    Field<uint32_t> millis;
+
+    if (value != NULL)
+    {
+        const char * t = value->c_str();
+        uint32_t hours = (t[0] - '0') * 10 + (t[1] - '0');
+        uint32_t minutes = (t[2] - '0') * 10 + (t[3] - '0');
+        uint32_t seconds = (t[4] - '0') * 10 + (t[5] - '0');
+        uint32_t hundredths = (t[7] - '0') * 10 + (t[8] - '0');
+
+        millis.setValue(((hours * 60 + minutes) * 60 + seconds) * 1000 + hundredths * 10, true);
+    }
+
+    return millis;
+}
+
+/**
+ * Writes the given sentence to a row of the columns, using the same sentence classes (and `GROUP`
+ * projections) as the rest of the parser.
+ */
+static void writeRow(ParsedSentence& parsed, FixColumns * const columns, size_t row)
+{
+    TIME * const time = parsed.as<TIME>();
+    POS * const pos = parsed.as<POS>();
+    ALTITUDE * const alt = parsed.as<ALTITUDE>();
+    GGA * const gga = parsed.as<GGA>();
+    GNS * const gns = parsed.as<GNS>();
+    GSA * const gsa = parsed.as<GSA>();
+
+    // Only GGA and GNS give the number of satellites, whereas GSA also gives the HDOP
+    Field<uint8_t> numSV = gga != NULL ? gga->getNumSatellites() : gns != NULL ? gns->getNumSV() : Field<uint8_t>();
+    Field<float_t> HDOP = gga != NULL ? gga->getHDOP() : gns != NULL ? gns->getHDOP() : gsa != NULL ? gsa->getHDOP() : Field<float_t>();
+
+    columns->type[row] = (uint8_t) parsed.getType();
+    setColumn(columns->time, columns->valid[FIX_TIME], row, time != NULL ? timeOfDay(time->getTime()) : Field<uint32_t>());
+    setColumn(columns->lat, columns->valid[FIX_LAT], row, pos != NULL ? pos->getLatitudeE7() : Field<int32_t>());
+    setColumn(columns->lon, columns->valid[FIX_LON], row, pos != NULL ? pos->getLongitudeE7() : Field<int32_t>());
+    setColumn(columns->alt, columns->valid[FIX_ALT], row, alt != NULL ? alt->getAltitude() : Field<float_t>());
+    setColumn(columns->numSV, columns->valid[FIX_NUM_SV], row, numSV);
+    setColumn(columns->HDOP, columns->valid[FIX_HDOP], row, HDOP);
+}
+
+/**
+ * Parses a buffer of newline separated NMEA sentences into the given columns. Only valid sentences of the
+ * `BATCH_SENTENCES` types are written, each as a single row appended after `columns->length`. All other
+ * lines are skipped without being parsed.
+ *
+ * Parsing stops at the first incomplete line (ie. a line without a '\n'), or once the columns are full,
+ * so that a large file can be parsed in chunks by passing the unconsumed bytes on with the next chunk.
+ *
+ * @param buffer The buffer of sentences. Each sentence ends with either "\r\n" or "\n".
+ * @param length The number of bytes in the buffer.
+ * @param columns The columns to write the sentences to. `length` is updated with the number of rows.
+ *
+ * @returns The number of bytes of the buffer that were consumed.
+ */
+size_t parseBatch(const char * buffer, size_t length, FixColumns * const columns)
+{
+    size_t offset = 0;
+    NMEALine scanned;
+
+    if (buffer == NULL || columns == NULL)
+    {
+        return 0;
+    }
+
+    while (offset < length && columns->length < columns->capacity)
+    {
+        const char * line = buffer + offset;
+        const char * end = (const char *) memchr(line, '\n', length - offset);
+        size_t lineLength;
+
+        /* The final line is incomplete, so leave it for the next chunk */
+        if (end == NULL)
+        {
+            break;
+        }
+
+        lineLength = end - line;
+        offset += lineLength + 1;
+
+        if (lineLength > 0 && line[lineLength - 1] == '\r')
+        {
+            lineLength--;
+        }
+
+        if (scanNMEA(line, lineLength, &scanned) != 0)
+        {
+            continue;
+        }
+
+        /* Sentences that do not contribute to any column are classified, but not parsed */
+        ParsedSentence parsed(&scanned, BATCH_SENTENCES);
+
+        if (parsed.getType() != NMEA_INV)
+        {
+            writeRow(parsed, columns, columns->length);
+            columns->length++;
+        }
+    }
+
+    return offset;
+}
+
+/* ------------------------ END Batch Definitions ----------------------- */
@@ -0,0 +1,74 @@
+/**
+ * FILE: batch.hpp
+ * PURPOSE: To declare the batch parser, which parses a buffer of many NMEA sentences into columns of
+ *          fix data (struct-of-arrays) for offline processing, such as post-flight analysis.
+ *
+ * UPDATED: 17 Oct. 2026
+ */
+
+#ifndef INC_BATCH_HPP_
+#define INC_BATCH_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "sentences.hpp"
+
+/* The number of 32-bit words needed for a validity bitmap of the given number of rows */
+#define BATCH_BITMAP_WORDS(rows) (((rows) + 31) / 32)
+
+/* The sentence types that contribute rows to a batch */
+#define BATCH_SENTENCES NMEA_ID::mask(NMEA_GGA, NMEA_GLL, NMEA_GNS, NMEA_GSA, NMEA_RMC)
+
+/**
+ * The columns of a batch. Each column has a validity bitmap, where bit `i % 32` of word `i / 32` is set
+ * if the value in row `i` of the column is valid.
+ */
+enum FixColumn
+{
+    FIX_TIME,
+    FIX_LAT,
+    FIX_LON,
+    FIX_ALT,
+    FIX_NUM_SV,
+    FIX_HDOP,
+    N_FIX_COLUMNS
+};
+
+/**
+ * A set of columns that a batch of sentences is parsed into. Each row is a single sentence, with the
+ * values that the sentence type does not contain marked as invalid (eg. the altitude of an `RMC` row).
+ *
+ * All of the arrays are provided by the caller and must be able to hold `capacity` rows. The validity
+ * bitmaps must each hold `BATCH_BITMAP_WORDS(capacity)` words.
+ */
+struct FixColumns
+{
+    size_t capacity;                    // The number of rows that each column can hold
+    size_t length;                      // The number of rows that have been written
+    uint8_t * type;                     // The `Sentences` type of each row
+    uint32_t * time;                    // The time of day (UTC) in milliseconds
+    int32_t * lat;                      // The latitude in 1e-7 degrees
+    int32_t * lon;                      // The longitude in 1e-7 degrees
+    float_t * alt;                      // The altitude above mean sea level in metres
+    uint8_t * numSV;                    // The number of satellites used
+    float_t * HDOP;                     // The horizontal dilution of precision
+    uint32_t * valid[N_FIX_COLUMNS];    // The validity bitmap of each column
+};
+
+size_t parseBatch(const char * buffer, size_t length, FixColumns * const columns);
+
+/**
+ * Determines whether the value in the given row of a column is valid.
+ *
+ * @param bitmap The validity bitmap of the column.
+ * @param row The row to check.
+ *
+ * @returns `true` if the value is valid, or `false` otherwise.
+ */
+inline bool batchValid(const uint32_t * bitmap, size_t row)
+{
+    return (bitmap[row / 32] >> (row % 32)) & 1;
+}
+
+#endif
@@ -29,41 +29,114 @@ uint8_t * buffNext(uint8_t ** buffer, const uint8_t * delim, size_t delimLength,
 	return data;
 }
 
-// NOTE: Will not find the needle if bufferStart has split it.
-uint8_t * findInBuff(uint8_t * haystack, const uint8_t * needle, size_t needleLength, size_t bufferStart, size_t bufferLength)
+/**
+ * Returns whether the needle is found at the given offset of the data made up of the two segments. The
+ * needle may start in the first segment and continue into the second.
+ */
+static uint8_t matchInSegments(const uint8_t * first, size_t firstLength, const uint8_t * second, const uint8_t * needle, size_t needleLength, size_t offset)
 {
-	uint8_t * found = NULL;
-	uint8_t * searchLoc = NULL;
-	uint8_t currByte = 0;
+	size_t inFirst = 0;
 
-	size_t i = 0;
-	size_t j = 0;
-
-	/* Scan the string for instances of the needle, exiting when found */
-	for (i = 0; i < bufferLength - needleLength + 1; i++)
+	if (offset < firstLength)
 	{
-		for (j = 0; j < needleLength; j++)
+		inFirst = firstLength - offset < needleLength ? firstLength - offset : needleLength;
+
+		if (memcmp(first + offset, needle, inFirst) != 0)
 		{
-			searchLoc = haystack + ((i + bufferStart + j) % bufferLength);
+			return 0;
+		}
 
-			currByte = *searchLoc;
+		offset = 0;
+	}
+	else
+	{
+		offset -= firstLength;
+	}
 
-			if (currByte != needle[j])
-			{
-				found = NULL;
-				break;
-			}
+	return memcmp(second + offset, needle + inFirst, needleLength - inFirst) == 0;
+}
 
-			found = haystack + (i + bufferStart) % bufferLength;
+/**
+ * Finds the first instance of the needle in data that is made up of two contiguous segments, such as
+ * the part of a ring buffer before its end and the part that continues from its start. An instance may
+ * start in the first segment and continue into the second.
+ *
+ * Only the first byte of the needle is looked for byte by byte, using `memchr` (which compares a word or
+ * vector at a time on both the STM32 and the host), and the rest of the needle is only compared where the
+ * first byte is found. This is quickest when the first byte of the needle is rare, eg. '$', '*', "\r\n"
+ * or the UBX sync characters.
+ *
+ * @param first The first segment of the data.
+ * @param firstLength The length of the first segment.
+ * @param second The second segment of the data, which may be NULL if `secondLength` is 0.
+ * @param secondLength The length of the second segment.
+ * @param needle The bytes to find.
+ * @param needleLength The number of bytes to find.
+ *
+ * @returns A pointer to the first byte of the instance (in either segment), or NULL if there is none.
+ */
+const uint8_t * findInSegments(const uint8_t * first, size_t firstLength, const uint8_t * second, size_t secondLength, const uint8_t * needle, size_t needleLength)
+{
+	size_t total = firstLength + secondLength;
+	size_t offset = 0;
+	const uint8_t * candidate;
+
+	if (needleLength == 0 || needleLength > total)
+	{
+		return NULL;
+	}
+
+	/* Instances must start early enough to end within the data */
+	while (offset <= total - needleLength)
+	{
+		const uint8_t * segment = offset < firstLength ? first : second;
+		size_t start = offset < firstLength ? offset : offset - firstLength;
+		size_t end = offset < firstLength ? firstLength : secondLength;
+
+		/* Only search up to the last possible start, as the segment may end after it */
+		if (end - start > total - needleLength - offset + 1)
+		{
+			end = start + total - needleLength - offset + 1;
 		}
-		
-		if (found != NULL)
+
+		candidate = (const uint8_t *) memchr(segment + start, needle[0], end - start);
+
+		if (candidate == NULL)
+		{
+			offset += end - start;
+			continue;
+		}
+
+		offset += candidate - (segment + start);
+
+		if (matchInSegments(first, firstLength, second, needle, needleLength, offset))
 		{
-			break;
+			return candidate;
 		}
+
+		offset++;
 	}
-	
-	return found;
+
+	return NULL;
+}
+
+/**
+ * Finds the first instance of the needle in a circular buffer, starting from `bufferStart` and wrapping
+ * around the end of the buffer. An instance may be split by the end of the buffer.
+ *
+ * @returns A pointer to the first byte of the instance, or NULL if there is none.
+ */
+uint8_t * findInBuff(uint8_t * haystack, const uint8_t * needle, size_t needleLength, size_t bufferStart, size_t bufferLength)
+{
+	if (bufferLength == 0)
+	{
+		return NULL;
+	}
+
+	bufferStart %= bufferLength;
+
+	/* The data from bufferStart to the end of the buffer continues from the start of the buffer */
+	return (uint8_t *) findInSegments(haystack + bufferStart, bufferLength - bufferStart, haystack, bufferStart, needle, needleLength);
 }
 
 // NOTE: destLength must be less than buffer length
@@ -93,7 +166,6 @@ uint8_t * copyFromBuff(uint8_t * buffer, size_t destLength, uint8_t * needle, si
 uint16_t numInstances(const uint8_t * buffer, size_t bufferLength, const uint8_t * delim, size_t delimLength)
 {
 	uint16_t nTokens = 0;
-	uint16_t i = 0;
 
 	/* If the buffer is not longer than the delimiter, return */
 	if (bufferLength < delimLength)
@@ -101,13 +173,13 @@ uint16_t numInstances(const uint8_t * buffer, size_t bufferLength, const uint8_t
 		return 0;
 	}
 
-	/* Scan the string for instances of the delim, ending with the final delim size */
-	for (i = 0; i < bufferLength - delimLength + 1; i++)
+	const uint8_t * found = buffer;
+
+	/* Instances may overlap, so each search starts from the byte after the previous instance */
+	while ((found = findInSegments(found, bufferLength - (found - buffer), NULL, 0, delim, delimLength)) != NULL)
 	{
-		if (memcmp(delim, buffer + i, delimLength) == 0)
-		{
-			nTokens++;
-		}
+		nTokens++;
+		found++;
 	}
 
 	return nTokens;
@@ -11,6 +11,7 @@ extern "C"
 #endif
 
 uint8_t * buffNext(uint8_t ** buffer, const uint8_t * delim, size_t delimLength, size_t bufferStart, size_t bufferLength);
+const uint8_t * findInSegments(const uint8_t * first, size_t firstLength, const uint8_t * second, size_t secondLength, const uint8_t * needle, size_t needleLength);
 uint8_t * findInBuff(uint8_t * haystack, const uint8_t * needle, size_t needleLength, size_t bufferStart, size_t bufferLength);
 uint8_t * copyFromBuff(uint8_t * buffer, size_t destLength, uint8_t * needle, size_t needleLength, size_t bufferStart, size_t bufferLength);
 uint16_t numInstances(const uint8_t * buffer, size_t bufferLength, const uint8_t * delim, size_t delimLength);
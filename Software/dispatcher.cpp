@@ -0,0 +1,91 @@
+#include "dispatcher.hpp"
+
+/* ------------------- SentenceDispatcher Definitions ------------------- */
+
+SentenceDispatcher::SentenceDispatcher()
+{
+
+}
+
+/**
+ * Parses the given line once and hands the resulting sentence to every subscribed consumer that the
+ * sentence belongs to.
+ * 
+ * @param line The string from which to interpret the sentence.
+ * @param maxLength The maximum number of characters of `line` to read (see `scanNMEA`).
+ * 
+ * @returns The type of the dispatched sentence, or `NMEA_INV` if the line is not a valid sentence or
+ *          no subscribed consumer is interested in it.
+ */
+Sentences SentenceDispatcher::dispatch(const char * line, size_t maxLength)
+{
+    /* Nothing is interested in any sentence, so do not parse it */
+    if (this->interests == 0)
+    {
+        return NMEA_INV;
+    }
+
+    /* Sentences that no consumer is interested in are classified, but not parsed */
+    ParsedSentence parsed(line, maxLength, this->interests);
+
+    return this->publish(parsed);
+}
+
+/**
+ * Hands an already parsed sentence to every subscribed consumer that the sentence belongs to. This lets
+ * the sentence be parsed in one place (eg. one stage of a pipeline) and consumed in another.
+ *
+ * @param parsed The parsed sentence, which should be parsed with `getInterests` as the accepted types.
+ *
+ * @returns The type of the published sentence, or `NMEA_INV` if the sentence is not valid.
+ */
+Sentences SentenceDispatcher::publish(ParsedSentence& parsed)
+{
+    uint8_t i;
+
+    if (parsed.getType() != NMEA_INV)
+    {
+        for (i = 0; i < this->nSubscriptions; i++)
+        {
+            Subscription& subscription = this->subscriptions[i];
+
+            subscription.invoke(parsed, subscription.consumer, subscription.context);
+        }
+    }
+
+    return parsed.getType();
+}
+
+/**
+ * Hands a parsed UBX message to every subscribed consumer that the message belongs to, in the same way as
+ * a parsed sentence.
+ *
+ * @returns The type of the published message, or `UBX_INV` if the message is not valid.
+ */
+Messages SentenceDispatcher::publish(ParsedMessage& parsed)
+{
+    uint8_t i;
+
+    if (parsed.getType() != UBX_INV)
+    {
+        for (i = 0; i < this->nSubscriptions; i++)
+        {
+            Subscription& subscription = this->subscriptions[i];
+
+            subscription.invokeMessage(parsed, subscription.consumer, subscription.context);
+        }
+    }
+
+    return parsed.getType();
+}
+
+/**
+ * Returns the union of the sentence types that the subscribed consumers accept, so that the other types
+ * need not be parsed.
+ */
+SentenceMask SentenceDispatcher::getInterests()
+{
+    return this->interests;
+}
+
+/* ----------------- End SentenceDispatcher Definitions ----------------- */
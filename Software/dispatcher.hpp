@@ -0,0 +1,92 @@
+/**
+ * FILE: dispatcher.hpp
+ * PURPOSE: To declare the sentence dispatcher, which parses each NMEA sentence once and passes it to
+ *          every consumer that has subscribed to a type that the sentence belongs to.
+ * 
+ * UPDATED: 17 Oct. 2026
+ */
+
+#ifndef INC_DISPATCHER_HPP_
+#define INC_DISPATCHER_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "sentences.hpp"
+#include "ubx.hpp"
+
+/* The maximum number of consumers that can subscribe to a single dispatcher */
+#define MAX_SENTENCE_CONSUMERS 16
+
+/**
+ * Parses each given line exactly once and hands the resulting sentence to every subscribed consumer
+ * that the sentence belongs to. For example, a `GGA` sentence is handed to the consumers of `GGA`,
+ * `POS`, `POS3D`, `ALTITUDE` and `TIME`, but not to the consumers of `RMC`.
+ * 
+ * The cost of parsing a line is constant, regardless of the number of consumers, as each consumer
+ * receives a view of the same parsed sentence rather than parsing it again.
+ * 
+ * For example:
+```
+void printPosition(POS * const pos, void * context) {...}
+void printTime(TIME * const time, void * context) {...}
+
+SentenceDispatcher dispatcher;
+dispatcher.subscribe<POS>(printPosition);
+dispatcher.subscribe<TIME>(printTime);
+
+dispatcher.dispatch(line);
+```
+ *
+ * Parsed UBX messages are handed to the same consumers with `publish`, so eg. a consumer of `POS` receives
+ * the position from both `GGA` sentences and NAV-PVT messages.
+ */
+class SentenceDispatcher
+{
+    public:
+    template <typename T>
+    using Consumer = void (*)(T * const sentence, void * context);
+
+    SentenceDispatcher();
+
+    template <typename T> bool subscribe(Consumer<T> consumer, void * context = NULL);
+    Sentences dispatch(const char * line, size_t maxLength = SIZE_MAX);
+    Sentences publish(ParsedSentence& parsed);
+    Messages publish(ParsedMessage& parsed);
+    SentenceMask getInterests();
+
+    private:
+    /* A type-erased consumer. `invoke` and `invokeMessage` restore the type of the consumer that was subscribed. */
+    struct Subscription
+    {
+        void (* invoke)(ParsedSentence& parsed, void (* consumer)(), void * context);
+        void (* invokeMessage)(ParsedMessage& parsed, void (* consumer)(), void * context);
+        void (* consumer)();
+        void * context;
+    };
+
+    Subscription subscriptions[MAX_SENTENCE_CONSUMERS];
+    uint8_t nSubscriptions = 0;
+
+    /* The union of the accepted types of all subscribed consumers */
+    SentenceMask interests = 0;
+
+    template <typename T>
+    static void invoke(ParsedSentence& parsed, void (* consumer)(), void * context);
+    template <typename T>
+    static void invokeMessage(ParsedMessage& parsed, void (* consumer)(), void * context);
+};
+
+/* Include the template implementation after declaration
+ * NOTE: This is done as templates must either be fully defined in the header
+ *       or have specific implementations specified. To circumvent this, a file
+ *       with the template implementation can be included in the header to include
+ *       the implementation. This reduces the code in the header file.
+ * NOTE: Do NOT include dispatcher.tpp at the beginning of this file or at any point
+ *       in other header files.
+ * REFERENCE: https://stackoverflow.com/questions/495021/why-can-templates-only-be-implemented-in-the-header-file
+ * REFERENCE: https://isocpp.org/wiki/faq/templates#templates-defn-vs-decl
+ */
+#include "dispatcher.tpp"
+
+#endif
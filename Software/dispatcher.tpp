@@ -0,0 +1,84 @@
+/**
+ * FILE: dispatcher.tpp
+ * PURPOSE: To serve as the template implementation file for the sentence dispatcher
+ * 
+ * UPDATED: 17 Oct. 2026
+ * 
+ * NOTE: Do NOT include this file other than at the end of dispatcher.hpp.
+ *       Any other includes may lead to issues.
+ */
+
+/* ------------------- SentenceDispatcher Definitions ------------------- */
+
+/**
+ * Subscribes the given consumer to all sentences and messages belonging to the type `T`. `T` may either be a
+ * concrete sentence or message type (eg. `GGA` or `NAV_PVT`), or a `GROUP` type (eg. `POS`).
+ * 
+ * @param consumer The function to call with each dispatched sentence belonging to `T`. The sentence is
+ *                 only valid for the duration of the call.
+ * @param context A user-defined pointer that is passed to the consumer with each sentence.
+ * 
+ * @returns `true` if the consumer was subscribed, or `false` if there are already
+ *          `MAX_SENTENCE_CONSUMERS` subscriptions.
+ */
+template <typename T>
+bool SentenceDispatcher::subscribe(Consumer<T> consumer, void * context)
+{
+    static_assert(
+        std::is_base_of_v<BASE, T> ||
+        std::is_base_of_v<GROUP, T> ||
+        std::is_base_of_v<UBX, T>,
+        "Ensure that the given type is an accepted type (BASE, UBX, or a GROUP type)"
+    );
+
+    if (consumer == NULL || this->nSubscriptions >= MAX_SENTENCE_CONSUMERS)
+    {
+        return false;
+    }
+
+    Subscription& subscription = this->subscriptions[this->nSubscriptions];
+
+    subscription.invoke = SentenceDispatcher::invoke<T>;
+    subscription.invokeMessage = SentenceDispatcher::invokeMessage<T>;
+    subscription.consumer = reinterpret_cast<void (*)()>(consumer);
+    subscription.context = context;
+
+    this->nSubscriptions++;
+    this->interests |= T::acceptedTypes;
+
+    return true;
+}
+
+/**
+ * Calls the type-erased consumer with the parsed sentence if the sentence belongs to `T`.
+ */
+template <typename T>
+void SentenceDispatcher::invoke(ParsedSentence& parsed, void (* consumer)(), void * context)
+{
+    /* A UBX message type that is not part of any group is never a sentence */
+    if constexpr (std::is_base_of_v<BASE, T> || std::is_base_of_v<GROUP, T>)
+    {
+        T * const sentence = parsed.as<T>();
+
+        if (sentence != NULL)
+        {
+            reinterpret_cast<Consumer<T>>(consumer)(sentence, context);
+        }
+    }
+}
+
+/**
+ * Calls the type-erased consumer with the parsed message if the message belongs to `T`.
+ */
+template <typename T>
+void SentenceDispatcher::invokeMessage(ParsedMessage& parsed, void (* consumer)(), void * context)
+{
+    T * const message = parsed.as<T>();
+
+    if (message != NULL)
+    {
+        reinterpret_cast<Consumer<T>>(consumer)(message, context);
+    }
+}
+
+/* ----------------- End SentenceDispatcher Definitions ----------------- */
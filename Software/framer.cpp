@@ -0,0 +1,327 @@
+#include "framer.hpp"
+
+/* ---------------------- FrameScanner Definitions ---------------------- */
+
+FrameScanner::FrameScanner()
+{
+
+}
+
+/**
+ * Feeds the next bytes of the stream to the scanner. Any frames that are completed by the bytes are
+ * queued, and any partial frame at the end of the bytes is continued by the next call.
+ *
+ * @param data The next bytes of the stream.
+ * @param length The number of bytes.
+ *
+ * @returns The number of bytes that were scanned. This is only less than `length` if the policy is
+ *          `STAGE_WAIT` and the queue is full, in which case the scanner stops before the next frame and
+ *          the rest of the bytes must be fed again.
+ */
+size_t FrameScanner::feed(const uint8_t * data, size_t length)
+{
+    size_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        uint8_t byte = data[i];
+
+        switch (this->state)
+        {
+            case IDLE:
+                /* Waiting here means no bytes of the next frame are held, so the stream can resume later */
+                if (this->policy == STAGE_WAIT && (byte == '$' || byte == UBX_SYNC_CHAR_1) && this->frames.getSpace() == 0)
+                {
+                    return i;
+                }
+
+                this->begin(byte);
+                break;
+
+            case NMEA_BODY:
+                /* NMEA sentences are printable ASCII, so anything else means the sentence was cut short */
+                if (byte == '$' || byte < ' ' || byte > '~' || this->length + 5 > FRAMER_MAX_FRAME_SIZE)
+                {
+                    this->abandon(byte);
+                    break;
+                }
+
+                this->length++;
+
+                if (byte == '*')
+                {
+                    this->expected = this->length + 2;
+                    this->state = NMEA_CHECKSUM;
+                }
+                else
+                {
+                    this->check ^= byte;
+                }
+                break;
+
+            case NMEA_CHECKSUM:
+                if (!isxdigit(byte))
+                {
+                    this->abandon(byte);
+                    break;
+                }
+
+                this->given = this->given << 4 | (isdigit(byte) ? byte - '0' : (toupper(byte) - 'A' + 10));
+                this->length++;
+
+                if (this->length == this->expected)
+                {
+                    this->state = NMEA_CR;
+                }
+                break;
+
+            case NMEA_CR:
+            case NMEA_LF:
+                if (byte != (this->state == NMEA_CR ? '\r' : '\n'))
+                {
+                    this->abandon(byte);
+                    break;
+                }
+
+                this->length++;
+
+                if (this->state == NMEA_LF)
+                    this->complete();
+                else
+                    this->state = NMEA_LF;
+                break;
+
+            case UBX_SYNC:
+                if (byte != UBX_SYNC_CHAR_2)
+                {
+                    this->abandon(byte);
+                    break;
+                }
+
+                this->length++;
+                this->state = UBX_HEADER;
+                break;
+
+            case UBX_HEADER:
+                /* The Fletcher checksum covers the class, id, length and payload */
+                this->check += byte;
+                this->checkB += this->check;
+                this->length++;
+
+                /* The length is little endian and follows the sync characters, class and id */
+                if (this->length == 5)
+                {
+                    this->expected = byte;
+                }
+                else if (this->length == 6)
+                {
+                    this->expected = (this->expected | (uint32_t) byte << 8) + UBX_FRAME_OVERHEAD;
+
+                    /* A length that is too large is far more likely to be corrupt than real, and following it
+                     * would swallow the frames after it */
+                    if (this->expected > FRAMER_MAX_FRAME_SIZE)
+                    {
+                        this->abandon(byte);
+                        break;
+                    }
+
+                    this->state = this->expected == UBX_FRAME_OVERHEAD ? UBX_CK_A : UBX_PAYLOAD;
+                }
+                break;
+
+            case UBX_PAYLOAD:
+                this->check += byte;
+                this->checkB += this->check;
+                this->length++;
+
+                if (this->length == this->expected - 2)
+                {
+                    this->state = UBX_CK_A;
+                }
+                break;
+
+            case UBX_CK_A:
+            case UBX_CK_B:
+                /* As with an NMEA frame, the byte may be the start of the next frame if bytes were lost */
+                if (byte != (this->state == UBX_CK_A ? this->check : this->checkB))
+                {
+                    this->nChecksumFailed++;
+                    this->begin(byte);
+                    break;
+                }
+
+                this->length++;
+
+                if (this->state == UBX_CK_B)
+                    this->complete();
+                else
+                    this->state = UBX_CK_B;
+                break;
+        }
+
+        this->position++;
+    }
+
+    return length;
+}
+
+/**
+ * Sets what the scanner does when a frame is found but the queue is full - either drop the frame and
+ * keep scanning (`STAGE_DROP`, the default), or stop scanning until a frame is popped (`STAGE_WAIT`). The
+ * unscanned bytes then stay in the ring, so the backpressure reaches the receiver.
+ */
+void FrameScanner::setPolicy(StagePolicy policy)
+{
+    this->policy = policy;
+}
+
+/**
+ * Returns the counters of the bytes that have been received and of the frames that have been queued and
+ * lost. The counters of the ring are left to `Framer::getStats`.
+ */
+ReceiveStats FrameScanner::getStats()
+{
+    ReceiveStats stats = {};
+
+    stats.bytesReceived = this->position;
+    stats.framesQueued = this->nQueued;
+    stats.framesDropped = this->nDropped;
+    stats.framesMalformed = this->nMalformed;
+    stats.framesDiscarded = this->nDiscarded;
+    stats.checksumFailures = this->nChecksumFailed;
+
+    return stats;
+}
+
+/**
+ * Returns the position in the stream before which no byte is needed any more - the start of the oldest
+ * queued frame, or of the current frame if nothing is queued.
+ */
+uint32_t FrameScanner::getBoundary()
+{
+    size_t queued = this->frames.getSize();
+
+    /* The frames are consumed elsewhere, so the oldest is found from the number that have been queued */
+    if (queued > 0)
+    {
+        RingSegment<const Frame> oldest[2];
+
+        this->frames.getSegmentsAt(this->nQueued - (uint32_t) queued, 1, oldest);
+
+        return oldest[0].data->position;
+    }
+
+    return this->state != IDLE ? this->start : this->position;
+}
+
+/**
+ * Forgets the current frame and every queued frame, and continues scanning from the given position in
+ * the stream.
+ */
+void FrameScanner::reset(uint32_t position)
+{
+    this->nDiscarded += this->frames.getSize() + (this->state != IDLE ? 1 : 0);
+    this->frames.commitRead(this->frames.getSize());
+
+    this->state = IDLE;
+    this->position = position;
+}
+
+/**
+ * Starts a new frame if the given byte is the start of a frame, otherwise the byte is ignored.
+ */
+void FrameScanner::begin(uint8_t byte)
+{
+    if (byte == '$')
+    {
+        this->state = NMEA_BODY;
+    }
+    else if (byte == UBX_SYNC_CHAR_1)
+    {
+        this->state = UBX_SYNC;
+    }
+    else
+    {
+        this->state = IDLE;
+        return;
+    }
+
+    this->start = this->position;
+    this->length = 1;
+    this->check = 0;
+    this->checkB = 0;
+    this->given = 0;
+}
+
+/**
+ * Queues the current frame, now that it is complete, and waits for the next frame.
+ */
+void FrameScanner::complete()
+{
+    Frame frame = {this->state == UBX_CK_B ? FRAME_UBX : FRAME_NMEA, this->start, (uint16_t) this->length};
+
+    /* A sentence that was spliced together from two sentences (ie. bytes were lost between them) is
+     * almost always caught here, as its framing is still valid */
+    if (frame.type == FRAME_NMEA && this->check != this->given)
+    {
+        this->nChecksumFailed++;
+    }
+    else if (this->frames.write(&frame, 1) == 0)
+    {
+        this->nDropped++;
+    }
+    else
+    {
+        this->nQueued++;
+    }
+
+    this->state = IDLE;
+}
+
+/**
+ * Abandons the current frame, as the given byte cannot be part of it. The byte may be the start of the
+ * next frame (eg. a '$' in the middle of a sentence that was cut short), so it is not lost.
+ */
+void FrameScanner::abandon(uint8_t byte)
+{
+    this->nMalformed++;
+    this->begin(byte);
+}
+
+/* -------------------- End FrameScanner Definitions -------------------- */
+
+
+/* ------------------------- Frame Definitions -------------------------- */
+
+/**
+ * Returns the given frame as a single contiguous array. The frame is only copied if it wraps around the
+ * end of the ring, in which case it is stitched together in the given scratch buffer.
+ *
+ * @param view The frame to make contiguous.
+ * @param scratch A buffer of at least `FRAMER_MAX_FRAME_SIZE` bytes.
+ *
+ * @returns The contiguous frame, which is either in the ring or in the scratch buffer.
+ */
+const uint8_t * const stitchFrame(const FrameView& view, uint8_t * scratch)
+{
+    if (view.segments[1].length == 0)
+    {
+        return view.segments[0].data;
+    }
+
+    memcpy(scratch, view.segments[0].data, view.segments[0].length);
+    memcpy(scratch + view.segments[0].length, view.segments[1].data, view.segments[1].length);
+
+    return scratch;
+}
+
+/**
+ * Returns the byte at the given index of the frame (eg. the class of a UBX frame), whichever segment it is
+ * in. The index must be less than the length of the frame.
+ */
+uint8_t getFrameByte(const FrameView& view, size_t index)
+{
+    return index < view.segments[0].length ? view.segments[0].data[index] : view.segments[1].data[index - view.segments[0].length];
+}
+
+/* ----------------------- End Frame Definitions ------------------------ */
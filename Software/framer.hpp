@@ -0,0 +1,212 @@
+/**
+ * FILE: framer.hpp
+ * PURPOSE: To declare the framer, which finds the complete NMEA sentences and UBX messages in the raw
+ *          bytes received from the GNSS module and provides them to the main loop in place.
+ *
+ * UPDATED: 17 Oct. 2026
+ */
+
+#ifndef INC_FRAMER_HPP_
+#define INC_FRAMER_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <ctype.h>
+
+#include "ring.hpp"
+
+/* The largest frame that is kept and the size of a scratch buffer that any frame can be stitched into. An
+ * NMEA sentence is at most 82 characters, whereas a UBX-NAV-SIG message takes 16 bytes per signal (1488
+ * bytes for the 92 channels of a NEO-M9N) and a UBX-NAV-SAT message 12 bytes per satellite (up to 126) */
+#define FRAMER_MAX_FRAME_SIZE 1536
+
+/* The number of complete frames that can be queued - must be a power of 2 */
+#define FRAMER_QUEUE_LENGTH 16
+
+/* The UBX frame sync characters and the number of bytes around the payload (sync, class, id, length, CK) */
+#define UBX_SYNC_CHAR_1 0xB5
+#define UBX_SYNC_CHAR_2 0x62
+#define UBX_FRAME_OVERHEAD 8
+
+/* What a stage does with its output when the queue after it is full */
+enum StagePolicy
+{
+    STAGE_DROP, // Drop the output, so that the stage keeps up with its input
+    STAGE_WAIT  // Stop until the queue has space, leaving the input where it is
+};
+
+enum FrameType
+{
+    FRAME_NMEA,
+    FRAME_UBX
+};
+
+/**
+ * The location of a complete frame in the stream of received bytes. An NMEA frame includes the '$' and
+ * the "*hh\r\n" and a UBX frame includes the sync characters and the checksum.
+ *
+ * @note The checksum of every frame is checked as it is scanned, so a queued frame is always valid.
+ */
+struct Frame
+{
+    FrameType type;
+    uint32_t position;  // The position of the first byte of the frame in the stream
+    uint16_t length;    // The number of bytes in the frame
+};
+
+/**
+ * A complete frame, viewed in place in the ring buffer that it was received into. As the frame may wrap
+ * around the end of the ring, it is made up of at most two segments.
+ */
+struct FrameView
+{
+    FrameType type;
+    uint16_t length;                        // The number of bytes in the frame
+    RingSegment<const uint8_t> segments[2]; // The second segment is empty unless the frame wraps
+};
+
+/**
+ * Counters of the bytes and frames that have been received and lost, for sizing the buffers and checking
+ * that the main loop keeps up. Every counter counts from start up.
+ */
+struct ReceiveStats
+{
+    uint32_t bytesReceived;     // Bytes that have been taken from the ring, whether scanned or discarded
+    uint32_t bytesDropped;      // Bytes that were lost before they were scanned, as the ring was full
+    uint32_t bytesDiscarded;    // Bytes that were thrown away by `Framer::discard`
+    uint32_t framesQueued;      // Complete frames that were queued
+    uint32_t framesDropped;     // Complete frames that were skipped as the queue was full
+    uint32_t framesMalformed;   // Frames that were abandoned as they did not end as expected or were too large
+    uint32_t framesDiscarded;   // Queued and partial frames that were thrown away by `Framer::discard`
+    uint32_t checksumFailures;  // Frames that did not match their checksum, eg. as bytes were lost mid-frame
+    uint32_t peakFill;          // The most bytes that have been waiting in the ring at once
+};
+
+const uint8_t * const stitchFrame(const FrameView& view, uint8_t * scratch);
+uint8_t getFrameByte(const FrameView& view, size_t index);
+
+/**
+ * Splits a stream of bytes into NMEA (`$...*hh\r\n`) and UBX (`0xB5 0x62 ...`) frames. The scanner is
+ * resumable - each call to `feed` continues from where the previous call stopped, so a frame may be split
+ * across any number of calls - and each byte is only looked at once, in constant time.
+ *
+ * The bytes are not copied. Only the position and length of each complete frame is queued, so the bytes
+ * must be kept by the caller until the frame has been used (see `Framer`).
+ */
+class FrameScanner
+{
+    public:
+    FrameScanner();
+
+    size_t feed(const uint8_t * data, size_t length);
+    void setPolicy(StagePolicy policy);
+
+    ReceiveStats getStats();
+
+    protected:
+    SpscRing<Frame, FRAMER_QUEUE_LENGTH> frames;
+    uint32_t position = 0;  // The position of the next byte in the stream
+
+    uint32_t getBoundary();
+    void reset(uint32_t position);
+
+    private:
+    enum State
+    {
+        IDLE,               // Waiting for the start of a frame
+        NMEA_BODY,          // Waiting for the '*' before the checksum
+        NMEA_CHECKSUM,      // Waiting for the two checksum characters
+        NMEA_CR,            // Waiting for the '\r'
+        NMEA_LF,            // Waiting for the '\n'
+        UBX_SYNC,           // Waiting for the second sync character
+        UBX_HEADER,         // Waiting for the class, id and length
+        UBX_PAYLOAD,        // Waiting for the rest of the payload
+        UBX_CK_A,           // Waiting for the first checksum byte
+        UBX_CK_B            // Waiting for the second checksum byte
+    };
+
+    StagePolicy policy = STAGE_DROP;
+    State state = IDLE;
+    uint32_t start = 0;     // The position of the first byte of the current frame
+    uint32_t length = 0;    // The number of bytes of the current frame received so far
+    uint32_t expected = 0;  // The length of the current frame once its checksum ends
+    uint8_t check = 0;      // The checksum of the current frame (the NMEA XOR or the UBX CK_A), calculated so far
+    uint8_t checkB = 0;     // The UBX CK_B of the current frame, calculated so far
+    uint8_t given = 0;      // The checksum given at the end of the current NMEA frame, read so far
+
+    uint32_t nQueued = 0;           // Frames queued
+    uint32_t nDropped = 0;          // Frames skipped because the queue was full
+    uint32_t nMalformed = 0;        // Frames abandoned because they did not end as expected
+    uint32_t nDiscarded = 0;        // Queued and partial frames forgotten when the scanner was reset
+    uint32_t nChecksumFailed = 0;   // Frames that did not match their checksum
+
+    void begin(uint8_t byte);
+    void complete();
+    void abandon(uint8_t byte);
+};
+
+/**
+ * Finds the frames in the bytes received into a ring buffer, and provides each frame as a view into the
+ * ring. Only the bytes received since the last call to `receive` are scanned, and no byte is copied
+ * unless a frame wraps around the end of the ring and is stitched (see `stitchFrame`).
+ *
+ * With a mirrored ring (see `MirroredRingStorage`), every frame is a single segment, so no frame is ever
+ * copied.
+ *
+ * The framer is the consumer of the ring - the bytes of a frame are only released back to the ring once
+ * the frame has been popped, whereas bytes that are not part of any frame are released as soon as they
+ * are scanned. Only `receive` reads from or releases to the ring, so frames may be peeked and popped in a
+ * different thread to the one that calls `receive`.
+ *
+ * For example:
+```
+SpscRing<uint8_t, 2048> rxRing;
+Framer<2048> framer(rxRing);
+
+framer.receive();
+
+FrameView frame;
+while (framer.peek(frame))
+{
+    ...
+    framer.pop();
+}
+```
+ */
+template <size_t capacity, typename Storage = RingStorage<uint8_t, capacity>> class Framer : public FrameScanner
+{
+    static_assert(FRAMER_MAX_FRAME_SIZE < capacity, "Ensure that a complete frame fits in the ring");
+
+    public:
+    Framer(SpscRing<uint8_t, capacity, Storage>& ring);
+
+    size_t receive(size_t budget = SIZE_MAX);
+    bool hasUnscanned();
+    bool peek(FrameView& view);
+    void pop();
+    void discard();
+
+    ReceiveStats getStats();
+
+    private:
+    SpscRing<uint8_t, capacity, Storage>& ring;
+    uint32_t released = 0;  // The position in the stream up to which the bytes have been released
+    uint32_t nBytesDiscarded = 0;
+
+    void release();
+};
+
+/* Include the template implementation after declaration
+ * NOTE: This is done as templates must either be fully defined in the header
+ *       or have specific implementations specified. To circumvent this, a file
+ *       with the template implementation can be included in the header to include
+ *       the implementation. This reduces the code in the header file.
+ * NOTE: Do NOT include framer.tpp at the beginning of this file or at any point
+ *       in other header files.
+ * REFERENCE: https://stackoverflow.com/questions/495021/why-can-templates-only-be-implemented-in-the-header-file
+ * REFERENCE: https://isocpp.org/wiki/faq/templates#templates-defn-vs-decl
+ */
+#include "framer.tpp"
+
+#endif
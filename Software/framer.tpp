@@ -0,0 +1,151 @@
+/**
+ * FILE: framer.tpp
+ * PURPOSE: To serve as the template implementation file for the framer declared in framer.hpp
+ *
+ * UPDATED: 17 Oct. 2026
+ *
+ * NOTE: Do NOT include this file other than at the end of framer.hpp.
+ *       Any other includes may lead to issues.
+ */
+
+/* ------------------------- Framer Definitions ------------------------- */
+
+/**
+ * Creates a framer for the bytes received into the given ring. The framer must be the only consumer of
+ * the ring.
+ */
+template <size_t capacity, typename Storage>
+Framer<capacity, Storage>::Framer(SpscRing<uint8_t, capacity, Storage>& ring) : ring(ring)
+{
+
+}
+
+/**
+ * Scans the bytes that have been received since the last call, in place, and queues any frames that they
+ * complete. Bytes that are no longer needed (ie. that are not part of a frame that is still queued) are
+ * released back to the ring.
+ *
+ * @param budget The maximum number of bytes to scan, so that the caller can bound the time spent here.
+ *
+ * @returns The number of bytes that were scanned, which is less than the number received if the budget
+ *          ran out or if the scanner is waiting for the queue (see `FrameScanner::setPolicy`).
+ */
+template <size_t capacity, typename Storage>
+size_t Framer<capacity, Storage>::receive(size_t budget)
+{
+    RingSegment<const uint8_t> segments[2];
+    size_t scanned;
+
+    this->ring.getReadSegments(this->position - this->released, budget, segments);
+
+    scanned = this->feed(segments[0].data, segments[0].length);
+
+    if (scanned == segments[0].length)
+    {
+        scanned += this->feed(segments[1].data, segments[1].length);
+    }
+
+    this->release();
+
+    return scanned;
+}
+
+/**
+ * Returns whether any bytes have been received that `receive` has not scanned yet, eg. so that the caller
+ * can sleep until the next byte is received instead of polling.
+ */
+template <size_t capacity, typename Storage>
+bool Framer<capacity, Storage>::hasUnscanned()
+{
+    return this->ring.getSize() > this->position - this->released;
+}
+
+/**
+ * Views the oldest complete frame in place, without removing it from the queue.
+ *
+ * @param view The view to set to the frame.
+ *
+ * @returns `true` if there is a complete frame, or `false` otherwise.
+ *
+ * @note The view remains valid until the frame is popped.
+ */
+template <size_t capacity, typename Storage>
+bool Framer<capacity, Storage>::peek(FrameView& view)
+{
+    RingSegment<const Frame> oldest = this->frames.getReadSegment();
+
+    if (oldest.length == 0)
+    {
+        return false;
+    }
+
+    view.type = oldest.data->type;
+    view.length = oldest.data->length;
+    this->ring.getSegmentsAt(oldest.data->position, oldest.data->length, view.segments);
+
+    return true;
+}
+
+/**
+ * Removes the oldest complete frame from the queue. Its bytes are released back to the ring by the next
+ * call to `receive`, so that only `receive` ever reads from the ring.
+ */
+template <size_t capacity, typename Storage>
+void Framer<capacity, Storage>::pop()
+{
+    if (this->frames.getReadSegment().length > 0)
+    {
+        this->frames.commitRead(1);
+    }
+}
+
+/**
+ * Discards every received byte and every frame, complete or not, so that scanning starts again from the
+ * next byte that is received. This is needed when the bytes in the ring can no longer be trusted, eg.
+ * when a receiver that cannot be stopped has overwritten bytes that had not been released.
+ *
+ * @note This empties the frame queue, so it must not be called while frames are used in another thread.
+ */
+template <size_t capacity, typename Storage>
+void Framer<capacity, Storage>::discard()
+{
+    size_t size = this->ring.getSize();
+
+    this->ring.commitRead(size);
+    this->released += size;
+
+    /* Any bytes beyond the capacity were overwritten, so they are already counted as dropped by the ring */
+    this->nBytesDiscarded += size < capacity ? size : capacity;
+
+    this->reset(this->released);
+}
+
+/**
+ * Returns the counters of the bytes and frames that have been received and lost, including those of the
+ * ring (see `ReceiveStats`).
+ */
+template <size_t capacity, typename Storage>
+ReceiveStats Framer<capacity, Storage>::getStats()
+{
+    ReceiveStats stats = FrameScanner::getStats();
+
+    stats.bytesDropped = this->ring.getDropped();
+    stats.bytesDiscarded = this->nBytesDiscarded;
+    stats.peakFill = this->ring.getPeak();
+
+    return stats;
+}
+
+/**
+ * Releases every byte that is no longer needed back to the ring, so that it can be received into again.
+ */
+template <size_t capacity, typename Storage>
+void Framer<capacity, Storage>::release()
+{
+    uint32_t boundary = this->getBoundary();
+
+    this->ring.commitRead(boundary - this->released);
+    this->released = boundary;
+}
+
+/* ----------------------- End Framer Definitions ----------------------- */
@@ -64,36 +64,37 @@ char* getQuality(const char data) {
 	}
 }
 
+/**
+ * Converts the given header to the type of sentence that it contains
+ * 
+ * @param header The header from which to extract the sentence type in
+ * 				 the format: $TTSSS
+ * 
+ * @returns The sentence type from the header or NMEA_INV if it cannot be
+ * 			determined.
+ * 
+ * @note This function assumes correct format of the header as $TTSSS
+ */
 Sentences getSentenceType(const char * header)
 {
-	char type[4];
+	static const uint8_t nTypes = 20;
+	static const char types[20][4] = {
+		"DTM", "GAQ", "GBQ", "GBS", "GGA", "GLL", "GLQ", "GNQ", "GNS", "GPQ",
+		"GRS", "GSA", "GST", "GSV", "RLM", "RMC", "TXT", "VLW", "VTG", "ZDA"
+	};
 
-	strncpy(type, header + 3, 3);
+	uint8_t i;
 
-	if (strcmp(type, "GSA") == 0)
-	{
-		return GSA;
-	}
-	else if (strcmp(type, "VTG") == 0)
+	for (i = 0; i < nTypes; i++)
 	{
-		return VTG;
-	}
-	else if (strcmp(type, "GGA") == 0)
-	{
-		return GGA;
-	}
-	else if (strcmp(type, "RMC") == 0)
-	{
-		return RMC;
-	}
-	else if (strcmp(type, "GLL") == 0)
-	{
-		return GLL;
-	}
-	else
-	{
-		return INV;
+		if (strncmp(types[i], header + 3, 3) == 0)
+		{
+			/* The types are in the same order as the Sentences enum, offset by NMEA_INV */
+			return (Sentences) (NMEA_DTM + i);
+		}
 	}
+
+	return NMEA_INV;
 }
 
 GNSSData* parseNMEAData(const char *data) {
@@ -134,19 +135,19 @@ GNSSData* parseNMEAData(const char *data) {
 
 					switch(sent_type)
 					{
-						case GGA:
+						case NMEA_GGA:
 							errCode = captureGGAData(lineArr, nArgs, gnssData);
 							break;
-						case GLL:
+						case NMEA_GLL:
 							errCode = captureGLLData(lineArr, nArgs, gnssData);
 							break;
-						case GSA:
+						case NMEA_GSA:
 							errCode = captureGSAData(lineArr, nArgs, gnssData);
 							break;
-						case RMC:
+						case NMEA_RMC:
 							errCode = captureRMCData(lineArr, nArgs, gnssData);
 							break;
-						case VTG:
+						case NMEA_VTG:
 							errCode = captureVTGData(lineArr, nArgs, gnssData);
 							break;
 						default:
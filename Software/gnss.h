@@ -22,7 +22,7 @@ extern "C"
 #endif
 
 typedef enum {INVALID, NONE, GPS, GLONASS, GALILEO, BEIDOU} Constellation;
-typedef enum {INV, DTM, GAQ, GBQ, GBS, GGA, GLL, GLQ, GNQ, GNS, GPQ, GRS, GSA, GST, GSV, RLM, RMC, TXT, VLW, VTG, ZDA} Sentences;
+typedef enum {NMEA_INV, NMEA_DTM, NMEA_GAQ, NMEA_GBQ, NMEA_GBS, NMEA_GGA, NMEA_GLL, NMEA_GLQ, NMEA_GNQ, NMEA_GNS, NMEA_GPQ, NMEA_GRS, NMEA_GSA, NMEA_GST, NMEA_GSV, NMEA_RLM, NMEA_RMC, NMEA_TXT, NMEA_VLW, NMEA_VTG, NMEA_ZDA} Sentences;
 
 typedef struct GNSSData {
 	Constellation constellation;
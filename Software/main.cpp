@@ -31,6 +31,11 @@
 #include "gnss.h"
 #include "ubx.hpp"
 #include "buffer.h"
+#include "dispatcher.hpp"
+#include "framer.hpp"
+#include "ring.hpp"
+#include "transmit.hpp"
+#include "pipeline.hpp"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -55,15 +60,24 @@ DMA_HandleTypeDef hdma_usart1_rx;
 
 /* USER CODE BEGIN PV */
 
-#define MAIN_BUFF_SIZE 2048
-#define READ_SIZE 16	// The number of characters to read before the interrupt is called - must be a factor of the MAIN_BUFF_SIZE
-static volatile char MainBuf[MAIN_BUFF_SIZE + 1];	// + 1 so that the last character is always \0
-static volatile uint8_t temp[READ_SIZE];
-static volatile uint32_t saveIdx = 0;
-static volatile uint32_t nmeaIdx = 0;
-static volatile uint32_t ubxIdx = 0;
-static volatile uint16_t nCompletions = 0;
-static volatile uint32_t totalRead = 0;
+#define MAIN_BUFF_SIZE 2048	// Must be a power of 2
+static SpscRing<uint8_t, MAIN_BUFF_SIZE> rxRing;	// Written by the circular DMA transfer, read by the main loop
+static uint16_t dmaPosition = 0;	// The index in the ring that the DMA transfer had reached at the last receive event
+static volatile bool rxDiscard = false;	// Set when received bytes have been overwritten or lost, so the ring cannot be trusted
+static uint64_t sleepCycles = 0;	// The CPU cycles spent asleep waiting for bytes since the statistics were last printed
+
+#define STATS_PERIOD 10000	// The time in ms between each print of the receive statistics and the CPU headroom
+
+bool startTransmit(const uint8_t * data, size_t length, void * context);
+static TxQueue<1024> telemetry(startTransmit, &huart2, HAL_GetTick);	// Diagnostics to the PC, which are dropped if they do not fit
+static TxQueue<512> commands(startTransmit, &huart1, HAL_GetTick);	// UBX commands to the GNSS module, which wait for space unless the UART stops transmitting
+static Framer<MAIN_BUFF_SIZE> framer(rxRing);	// Finds the frames in the received bytes, in place
+static SentenceDispatcher dispatcher;	// Hands each sentence to every consumer that it belongs to
+static SatelliteTable satellites;	// The sky view, from the NAV-SAT and NAV-SIG messages
+
+// The ring cannot be stopped, so full queues drop frames rather than holding up the ring, except that
+// the parse stage waits for the publish stage, as dropping a frame that has been parsed wastes the parse
+static Pipeline<MAIN_BUFF_SIZE> pipeline(framer, dispatcher, STAGE_DROP, STAGE_WAIT, HAL_GetTick);
 
 /* USER CODE END PV */
 
@@ -86,6 +100,12 @@ static void printUART(const char * __restrict format, ...) _ATTRIBUTE((__format_
 #endif
 
 char * findBufString(char * haystack, const char * needle, size_t bufferStart, size_t bufferLength);
+void startReception();
+void discardOverrun();
+void waitForReceive();
+void printStats(uint32_t elapsed, PipelineStats stages);
+void handleMessages();
+bool transmitFailed(UART_HandleTypeDef * huart);
 void configureDYNMODEL();
 
 /* USER CODE END PFP */
@@ -120,6 +140,43 @@ void printArr_c(uint8_t * arr, uint16_t size)
 	}
 }
 
+void printPosition(POS * const pos, void * context)
+{
+	Field<double_t> lat, lon;
+	lat = pos->getLatitude();
+	lon = pos->getLongitude();
+	volatile double flat = 0.0, flon = 0.0;
+
+	if (lat.getValue() != NULL && lon.getValue() != NULL)
+	{
+		flat = *lat.getValue();
+		flon = *lon.getValue();
+	}
+
+	telemetry.print(TX_DROP, "Latitude is: %f, whilst longitude is: %f\r\n", flat, flon);
+}
+
+void printTime(TIME * const time, void * context)
+{
+	const std::string * t = time->getTime().getValue();
+
+	if (t != NULL)
+	{
+		telemetry.print(TX_DROP, "The current time is: %s\r\n", t->c_str());
+	}
+}
+
+void printTTFF(NAV_STATUS * const status, void * context)
+{
+	static bool printed = false;	// The time to first fix only changes after a reset, so it is printed once
+
+	if (!printed && status->getFixOK() && status->getTTFF() != 0)
+	{
+		// If the line is dropped as the queue is full, it is printed with the next message instead
+		printed = telemetry.print(TX_DROP, "Time to first fix: %lu ms (%lu ms since startup)\r\n", status->getTTFF(), status->getMSSS()) > 0;
+	}
+}
+
 /* USER CODE END 0 */
 
 /**
@@ -159,18 +216,25 @@ int main(void)
 
   uint32_t Timer = HAL_GetTick();
   uint16_t i = 0;
-  printf("Starting\n");
+  telemetry.print(TX_DROP, "Starting\n");
+
+  // The cycle counter measures the time spent asleep, to find the CPU headroom
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
 
-  // Begin reading from DMA. Must be executed for the callback loop to begin
-  HAL_UART_Receive_DMA(&huart1, (uint8_t *) temp, READ_SIZE);
+  // Begin receiving into the ring. Must be executed for the receive events to begin
+  startReception();
 
   i = 0;
 
-  configureDYNMODEL();
+  // Each line is parsed once and handed to every consumer that it belongs to. The consumers are
+  // subscribed first, so that the sentences received whilst configuring the module are not lost
+  dispatcher.subscribe<POS>(printPosition);
+  dispatcher.subscribe<TIME>(printTime);
+  dispatcher.subscribe<NAV_STATUS>(printTTFF);
 
-  uint16_t readIdx = saveIdx;
-  uint32_t nCharsToRead = 0;
-  uint32_t nCharsPrevRead = 0;
+  configureDYNMODEL();
 
   /* USER CODE END 2 */
 
@@ -179,84 +243,23 @@ int main(void)
 
   while (1)
   {
-	  	  uint16_t startIdx_pre = saveIdx, nCompletions_pre = nCompletions;
-	  	  uint32_t totalRead_pre = totalRead;
+		  discardOverrun();
 
-		  char ** arr;
-		  uint16_t length;
-		  char delim[] = "\r\n";
-
-		  arr = (char **) splitBuff((uint8_t *) MainBuf, MAIN_BUFF_SIZE, readIdx, (uint8_t *) delim, strlen(delim), &length);
-
-
-		  // TODO: Implement logic to only continue if saveIdx > index of arr[length - 1]
-
-		  if (arr != NULL)
+		  // Each stage only does a bounded amount of work, so a slow consumer cannot hold up the ring.
+		  // Once every stage is idle, the CPU sleeps until the next bytes are received
+		  if (!pipeline.poll())
 		  {
-			  readIdx = (arr[length - 1] - *arr + readIdx) % MAIN_BUFF_SIZE;
-			  nCharsToRead = saveIdx > readIdx ? MAIN_BUFF_SIZE + readIdx - saveIdx : readIdx - saveIdx;
-
-			  uint32_t nRead = totalRead;
-
-			  if (nRead - nCharsPrevRead >= nCharsToRead)
-			  {
-				  nCharsPrevRead = nRead;
-
-				  uint16_t j;
-				  for (j = 0; j < length; j++)
-				  {
-					  printf("The current line (%d / %d) is: %s\t\tSave index is: %ld\tRead idx is: %d\r\n", j + 1, length, arr[j], saveIdx, readIdx);
-
-
-					  Sentence<POS> sentence(arr[j]);
-					  Sentence<TIME> sentence_time(arr[j]);
-	
-					  POS * sent = sentence.getSentence();
-					  TIME * time = sentence_time.getSentence();
-	
-					  if (sent != NULL) {
-
-						Field<float_t> lat, lon;
-						lat = sent->getLatitude();
-						lon = sent->getLongitude();
-						volatile float flat = 0.0, flon = 0.0;
-
-						if (lat.getValue() != NULL && lon.getValue() != NULL)
-						{
-							flat = *lat.getValue();
-							flon = *lon.getValue();
-						}
-
-	
-						printf("Latitude is: %f, whilst longitude is: %f\r\n", flat, flon);
-	
-					  }
-
-					  if (time != NULL)
-					  {
-						  const std::string * t = time->getTime().getValue();
-
-						  if (t != NULL)
-						  {
-							  printf("The current time is: %s\r\n", t->c_str());
-						  }
-					  }
-				  }
-
-			  }
+			  waitForReceive();
+		  }
 
+		  handleMessages();
 
-			  free(*arr); *arr = NULL;
-			  free(arr); arr = NULL;
-		  }
-		  else
+		  if (HAL_GetTick() - Timer >= STATS_PERIOD)
 		  {
-			  printf("Array is NULL\r\n");
+			  printStats(HAL_GetTick() - Timer, pipeline.getStats());
+			  Timer = HAL_GetTick();
 		  }
 
-		  uint16_t startIdx_post = saveIdx, nCompletions_post = nCompletions;
-		  uint32_t totalRead_post = totalRead;
-
     /* USER CODE END WHILE */
 
     /* USER CODE BEGIN 3 */
@@ -431,9 +434,11 @@ extern "C" {
 #endif
 
 PUTCHAR_PROTOTYPE {
-	/* Place your implementation of fputc here */
-	/* e.g. write a character to the USART1 and Loop until the end of transmission */
-	HAL_UART_Transmit(&huart2, (uint8_t*) &ch, 1, 0xFFFF);
+	/* The character is only queued, so printf never waits for the USART. Each character is queued (or
+	 * dropped) on its own, so a line may be cut short - whole lines should use `telemetry.print` instead */
+	uint8_t character = (uint8_t) ch;
+
+	telemetry.write(&character, 1, TX_DROP);
 
 	return ch;
 }
@@ -462,30 +467,67 @@ extern "C"
 {
 #endif
 
-void HAL_UART_RxCpltCallback(UART_HandleTypeDef * huart)
+/**
+ * Called by the HAL when the circular DMA transfer is half or fully complete, or when the UART line goes
+ * idle (ie. at the end of each burst from the module). The bytes that the DMA transfer has written into
+ * the ring since the last event are published to the main loop.
+ *
+ * @param huart The UART that received the bytes.
+ * @param Size The index in the ring up to which the DMA transfer has written.
+ */
+void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef * huart, uint16_t Size)
 {
-	memcpy((void *) (MainBuf + saveIdx), (void *) temp, READ_SIZE);
+	if (huart != &huart1)
+	{
+		return;
+	}
 
-	saveIdx += READ_SIZE;
-	totalRead += READ_SIZE;
+	// The transfer wraps to the start of the ring once it is full, so Size is MAIN_BUFF_SIZE at the end
+	uint16_t received = (Size - dmaPosition) & (MAIN_BUFF_SIZE - 1);
 
-	if (saveIdx >= MAIN_BUFF_SIZE)
+	if (received > rxRing.getSpace())
 	{
-		saveIdx = 0;
-		nCompletions++;
+		rxDiscard = true;
 	}
 
-//	MainBuf[saveIdx] = *temp;
-//	saveIdx++;
-//
-//	if (saveIdx >= MAIN_BUFF_SIZE)
-//	{
-//		saveIdx = 0;
-//	}
+	// The ring must always follow the transfer, even if unreleased bytes have been overwritten
+	rxRing.commitWrite(received);
+	dmaPosition = Size & (MAIN_BUFF_SIZE - 1);
+}
+
+/**
+ * Called by the HAL when a UART error has stopped a transfer. If a noise, framing or overrun error has
+ * stopped the reception, bytes have been lost, so the reception is restarted and whatever is in the ring
+ * is discarded. If a DMA error has stopped a transmission, it will never complete, so it is aborted to let
+ * the transmit queue carry on.
+ */
+void HAL_UART_ErrorCallback(UART_HandleTypeDef * huart)
+{
+	if (huart == &huart1)
+	{
+		if (transmitFailed(huart))
+		{
+			commands.abort();
+		}
+
+		// A transmit error does not stop the reception, which cannot be restarted whilst it is running
+		if (huart->RxState == HAL_UART_STATE_READY)
+		{
+			rxDiscard = true;
+			startReception();
+		}
+	}
+	else if (huart == &huart2)
+	{
+		if (transmitFailed(huart))
+		{
+			telemetry.abort();
+		}
+	}
 }
 
 // NOTE: For now, only a max of MAIN_BUFF_SIZE can be printed
-// Main timeout of 1000ms
+// The message is queued rather than transmitted, and is dropped if it does not fit in the queue
 static void printUART(const char * __restrict format, ...)
 {
 	static char str[MAIN_BUFF_SIZE + 1];
@@ -502,7 +544,22 @@ static void printUART(const char * __restrict format, ...)
 	// End variadic function for format
 	va_end(args);
 
-	HAL_UART_Transmit(&huart2, (uint8_t *) str, strlen(str), 1000);
+	telemetry.write((const uint8_t *) str, strlen(str), TX_DROP);
+}
+
+/**
+ * Called by the HAL when a transmit transfer is complete, so that the rest of the channel's queue is sent.
+ */
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef * huart)
+{
+	if (huart == &huart2)
+	{
+		telemetry.complete();
+	}
+	else if (huart == &huart1)
+	{
+		commands.complete();
+	}
 }
 
 #ifdef __cplusplus
@@ -511,32 +568,165 @@ static void printUART(const char * __restrict format, ...)
 
 
 
+/**
+ * Starts receiving from the GNSS module directly into the ring, using a circular DMA transfer that never
+ * stops. An event is raised when the transfer is half and fully complete, and when the line goes idle,
+ * so each burst from the module is published as soon as it ends, rather than once a whole chunk has been
+ * received.
+ */
+void startReception()
+{
+	// The DMA channel is set up by CubeMX in normal mode, so it is switched to circular mode here
+	if (hdma_usart1_rx.Init.Mode != DMA_CIRCULAR)
+	{
+		hdma_usart1_rx.Init.Mode = DMA_CIRCULAR;
+
+		if (HAL_DMA_Init(&hdma_usart1_rx) != HAL_OK)
+		{
+			Error_Handler();
+		}
+	}
+
+	// A restarted transfer begins at the start of the ring, so the ring skips to the same index
+	rxRing.commitWrite((MAIN_BUFF_SIZE - dmaPosition) & (MAIN_BUFF_SIZE - 1));
+	dmaPosition = 0;
+
+	if (HAL_UARTEx_ReceiveToIdle_DMA(&huart1, rxRing.getBuffer(), MAIN_BUFF_SIZE) != HAL_OK)
+	{
+		Error_Handler();
+	}
+}
+
+/**
+ * If received bytes have been overwritten or lost, makes the framer discard everything it has, so that
+ * no corrupted frame is provided.
+ */
+void discardOverrun()
+{
+	if (rxDiscard)
+	{
+		rxDiscard = false;
+		framer.discard();
+	}
+}
+
+/**
+ * Sleeps until an interrupt occurs, unless bytes have been received that have not been framed yet. Each
+ * burst from the module ends with an idle line event, so the CPU wakes once the sentences in the burst
+ * are complete rather than spinning while they arrive.
+ *
+ * @note The interrupts are disabled while checking for bytes, so a receive event that happens after the
+ *       check still wakes the CPU from `__WFI` (and is then handled once they are enabled again).
+ */
+void waitForReceive()
+{
+	__disable_irq();
+
+	if (!rxDiscard && !framer.hasUnscanned())
+	{
+		uint32_t start = DWT->CYCCNT;
+
+		__WFI();
+
+		sleepCycles += DWT->CYCCNT - start;
+	}
+
+	__enable_irq();
+}
+
+/**
+ * Prints the receive statistics and the CPU headroom (the share of the time spent asleep) over the given
+ * period, then the counters of the pipeline, so that it can be checked that the pipeline keeps up with the
+ * module. Every counter, other than the headroom, counts from start up.
+ */
+void printStats(uint32_t elapsed, PipelineStats stages)
+{
+	ReceiveStats received = framer.getStats();
+	// A period may be longer than a 32 bit cycle count (eg. 10 s at 480 MHz), so the cycles are counted in 64 bits
+	uint64_t elapsedCycles = (uint64_t) elapsed * (SystemCoreClock / 1000);
+	uint32_t idle = elapsedCycles > 0 ? (uint32_t) (sleepCycles * 100 / elapsedCycles) : 0;
+
+	telemetry.print(TX_DROP, "Idle: %lu%%, frames: %lu (dropped %lu, malformed %lu, checksum %lu, discarded %lu), bytes lost: %lu (discarded %lu), ring peak: %lu, satellites: %u (%u used)\r\n",
+			idle, received.framesQueued, received.framesDropped, received.framesMalformed, received.checksumFailures,
+			received.framesDiscarded, received.bytesDropped, received.bytesDiscarded, received.peakFill,
+			satellites.getNumSatellites(), satellites.getNumUsed());
+
+	// The longest calls are of the frame, parse and publish stages, so that the line fits in a single print
+	telemetry.print(TX_DROP, "Sentences: %lu (skipped %lu, dropped %lu, invalid %lu, published %lu, stalls %lu, peak %lu), messages: %lu (dropped %lu, peak %lu), stage max ms: %lu/%lu/%lu\r\n",
+			stages.framesParsed, stages.framesSkipped, stages.framesDropped, stages.sentencesInvalid, stages.sentencesPublished,
+			stages.stalls, stages.peakSentences, stages.messagesQueued, stages.messagesDropped, stages.peakMessages,
+			stages.maxTime[STAGE_FRAME], stages.maxTime[STAGE_PARSE], stages.maxTime[STAGE_PUBLISH]);
+
+	sleepCycles = 0;
+}
+
+/**
+ * Takes the UBX messages in the message queue. The satellite messages update the sky view, whereas any
+ * other messages are only waited for when configuring the module, so they are released rather than left
+ * to fill the queue.
+ */
+void handleMessages()
+{
+	const MessageSlot * message;
+
+	while ((message = pipeline.peekMessage()) != NULL)
+	{
+		satellites.read(message->message, message->length);
+
+		pipeline.popMessage();
+	}
+}
+
 char * findBufString(char * haystack, const char * needle, size_t bufferStart, size_t bufferLength)
 {
-	char * foundStr = NULL;
+	return (char *) findInBuff((uint8_t *) haystack, (const uint8_t *) needle, strlen(needle), bufferStart, bufferLength);
+}
+
+/**
+ * Starts transmitting the given bytes on the UART given as the context, for a `TxQueue`. DMA is used if
+ * CubeMX has linked a transmit DMA channel to the UART, otherwise the bytes are sent from the transmit
+ * interrupt. Either way, `HAL_UART_TxCpltCallback` is called once the bytes have been sent.
+ */
+bool startTransmit(const uint8_t * data, size_t length, void * context)
+{
+	UART_HandleTypeDef * huart = (UART_HandleTypeDef *) context;
+	HAL_StatusTypeDef status;
 
-	size_t i = 0;
+	if (huart->hdmatx != NULL)
+	{
+		status = HAL_UART_Transmit_DMA(huart, (uint8_t *) data, (uint16_t) length);
+	}
+	else
+	{
+		status = HAL_UART_Transmit_IT(huart, (uint8_t *) data, (uint16_t) length);
+	}
 
-	size_t needleLength = strlen(needle);
+	return status == HAL_OK;
+}
 
-	/* Scan the string for instances of the needle, exiting when found */
-	for (i = 0; i < bufferLength - needleLength + 1; i++)
+/**
+ * Returns whether the transmit DMA transfer of the given UART has failed and been stopped by the HAL, so
+ * that `HAL_UART_TxCpltCallback` will never be called for it. The error is cleared, so each failed
+ * transfer is only reported once.
+ */
+bool transmitFailed(UART_HandleTypeDef * huart)
+{
+	if (huart->hdmatx == NULL || huart->hdmatx->ErrorCode == HAL_DMA_ERROR_NONE || huart->gState != HAL_UART_STATE_READY)
 	{
-		if (strncmp(haystack + ((i + bufferStart) % bufferLength), needle, needleLength) == 0)
-		{
-			foundStr = haystack + ((i + bufferStart) % bufferLength);
-			break;
-		}
+		return false;
 	}
 
-	return foundStr;
+	huart->hdmatx->ErrorCode = HAL_DMA_ERROR_NONE;
+
+	return true;
 }
 
-HAL_StatusTypeDef sendConfiguration(CFG_VALGET getter,  UART_HandleTypeDef * uartHandle = &huart1, uint16_t timeout = 100)
+// The command is copied into the command queue, so it may be sent after this returns
+HAL_StatusTypeDef sendConfiguration(CFG_VALGET getter)
 {
 	std::vector<uint8_t> getter_vec = getter.getUBX();
 
-	return HAL_UART_Transmit(uartHandle, getter_vec.data(), getter_vec.size(), timeout);
+	return commands.write(getter_vec.data(), getter_vec.size(), TX_BLOCK) == getter_vec.size() ? HAL_OK : HAL_ERROR;
 }
 
 CFG_VALGET getConfiguration(CFG_VALGET getter, uint16_t timeout = 1000)
@@ -547,11 +737,7 @@ CFG_VALGET getConfiguration(CFG_VALGET getter, uint16_t timeout = 1000)
 
 	HAL_StatusTypeDef status = sendConfiguration(getter);
 
-	uint8_t * ubxReturn = NULL;
 	bool completeMsg = false;
-	uint16_t length = 0;
-	uint8_t * foundUBX = NULL;
-	uint16_t i = 0;
 
 	uint32_t timer = HAL_GetTick();
 
@@ -559,45 +745,26 @@ CFG_VALGET getConfiguration(CFG_VALGET getter, uint16_t timeout = 1000)
 	{
 		while(!completeMsg && HAL_GetTick() - timer < timeout)
 		{
-			ubxReturn = findInBuff((uint8_t *) MainBuf, configReturnHeader, 4, saveIdx, MAIN_BUFF_SIZE);
+			const MessageSlot * message;
 
-			if (ubxReturn != NULL)
-			{
-				// If the length is contiguous, just grab it
-				if (ubxReturn - (uint8_t *) MainBuf <= MAIN_BUFF_SIZE - 6)
-				{
-					length = UBX_DTYPES::convertU2(ubxReturn + 4);
-				}
-				// If the length is over the buffer end, get the split version
-				else
-				{
-					uint8_t firstByte = *(MainBuf + (ubxReturn - (uint8_t *) MainBuf + 4) % MAIN_BUFF_SIZE);
-					uint8_t secondByte = *(MainBuf + (ubxReturn - (uint8_t *) MainBuf + 5) % MAIN_BUFF_SIZE);
-
-					length = (uint16_t) secondByte << 8 | firstByte;
-				}
-
-				foundUBX = (uint8_t *) calloc(length + 8, sizeof(uint8_t));
+			// The sentences keep flowing to their consumers whilst waiting
+			discardOverrun();
+			pipeline.poll();
 
-				// Fill the foundUBX array with actual values
-				for (i = 0; i < length + 8; i++)
+			// Any other messages that arrive whilst waiting are discarded
+			while (!completeMsg && (message = pipeline.peekMessage()) != NULL)
+			{
+				if (memcmp(message->message, configReturnHeader, 4) == 0)
 				{
-					// Ensure correct wrapping around of the circular buffer
-					uint8_t byte = *(MainBuf + (ubxReturn - (uint8_t *) MainBuf + i) % MAIN_BUFF_SIZE);
+					found.readUBX(message->message, message->length);
 
-					foundUBX[i] = byte;
+					if (found.getValidity())
+					{
+						completeMsg = true;
+					}
 				}
 
-				found.readUBX(foundUBX);
-
-
-				if (found.getValidity())
-				{
-					completeMsg = true;
-				}
-
-
-				free(foundUBX);	// Note: this means that this->payload for the found message will be a floating pointer
+				pipeline.popMessage();	// Note: this means that this->payload for the found message will be a floating pointer
 			}
 		}
 	}
@@ -637,11 +804,11 @@ bool setConfiguration(CFG_VALSET setter, uint16_t timeout = 1000)
 {
 	bool successful = false;
 	HAL_StatusTypeDef transmissionSuccess;
-	uint8_t * found = NULL;
+	bool found = false;
 
 	std::vector<uint8_t> setter_vec = setter.getUBX();
 
-	transmissionSuccess = HAL_UART_Transmit(&huart1, setter_vec.data(), setter_vec.size(), 100);
+	transmissionSuccess = commands.write(setter_vec.data(), setter_vec.size(), TX_BLOCK) == setter_vec.size() ? HAL_OK : HAL_ERROR;
 
 	if (transmissionSuccess != HAL_OK)
 	{
@@ -653,12 +820,24 @@ bool setConfiguration(CFG_VALSET setter, uint16_t timeout = 1000)
 
 	uint32_t timer = HAL_GetTick();
 
-	while((found = (uint8_t *) findInBuff((uint8_t *) MainBuf, ack_vec.data(), ack_vec.size(), saveIdx, MAIN_BUFF_SIZE)) == NULL
-			&& HAL_GetTick() - timer < timeout)
+	while(!found && HAL_GetTick() - timer < timeout)
 	{
+		const MessageSlot * message;
+
+		// The sentences keep flowing to their consumers whilst waiting
+		discardOverrun();
+		pipeline.poll();
+
+		// Any other messages that arrive whilst waiting are discarded
+		while (!found && (message = pipeline.peekMessage()) != NULL)
+		{
+			found = message->length == ack_vec.size() && memcmp(message->message, ack_vec.data(), ack_vec.size()) == 0;
+
+			pipeline.popMessage();
+		}
 	}
 
-	if (found != NULL)
+	if (found)
 	{
 		successful = true;
 	}
@@ -728,7 +907,9 @@ void configureDYNMODEL()
 void Error_Handler(void)
 {
   /* USER CODE BEGIN Error_Handler_Debug */
-  printf("Error occurred!\r\n");
+  // Sent directly, as the transmit queue may never be drained once the interrupts are disabled
+  static const char message[] = "Error occurred!\r\n";
+  HAL_UART_Transmit(&huart2, (uint8_t *) message, sizeof(message) - 1, 100);
 
   /* User can add his own implementation to report the HAL error return state */
   __disable_irq();
@@ -0,0 +1,183 @@
+/**
+ * FILE: pipeline.hpp
+ * PURPOSE: To declare the receive pipeline, which moves the received bytes through explicit stages
+ *          (receive, frame, parse, publish) with a bounded queue between each stage.
+ *
+ * UPDATED: 17 Oct. 2026
+ */
+
+#ifndef INC_PIPELINE_HPP_
+#define INC_PIPELINE_HPP_
+
+#include <atomic>
+#include <optional>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "ring.hpp"
+#include "framer.hpp"
+#include "sentences.hpp"
+#include "dispatcher.hpp"
+
+/* The number of parsed sentences that can be queued between the parse and publish stages - must be a
+ * power of 2 */
+#define PIPELINE_QUEUE_LENGTH 8
+
+/* The number of UBX messages that can be queued for their consumer - must be a power of 2 */
+#define PIPELINE_MESSAGE_QUEUE_LENGTH 4
+
+/* The longest NMEA frame (a standard sentence is at most 82 characters) or UBX fix message (eg. NAV-PVT is
+ * 100 bytes) that is parsed */
+#define PIPELINE_MAX_LINE_LENGTH 128
+
+/* The default budget of each stage per call - bytes for the frame stage, frames for the parse stage and
+ * sentences for the publish stage */
+#define PIPELINE_FRAME_BUDGET 512
+#define PIPELINE_PARSE_BUDGET 4
+#define PIPELINE_PUBLISH_BUDGET 4
+
+/* The stages of the pipeline that are timed */
+enum PipelineStage
+{
+    STAGE_FRAME,
+    STAGE_PARSE,
+    STAGE_PUBLISH,
+    STAGE_COUNT
+};
+
+/**
+ * Returns the current time in any unit (eg. `HAL_GetTick` or a cycle counter), used to time each stage.
+ */
+typedef uint32_t (* PipelineClock)();
+
+/**
+ * The counters of a pipeline, counting from start up. The counters of the frame stage are in the
+ * framer's `ReceiveStats`.
+ */
+struct PipelineStats
+{
+    uint32_t framesParsed;          // NMEA frames and UBX fix messages that were parsed into the sentence queue
+    uint32_t framesSkipped;         // Frames that are too long to parse
+    uint32_t framesDropped;         // Frames that were dropped as the sentence queue was full (`STAGE_DROP`)
+    uint32_t sentencesInvalid;      // Frames that did not parse into a sentence that any consumer accepts
+    uint32_t sentencesPublished;    // Sentences that were handed to the consumers
+    uint32_t stalls;                // Times the parse stage stopped as the sentence queue was full (`STAGE_WAIT`)
+    uint32_t peakSentences;         // The most sentences that have been waiting to be published at once
+    uint32_t messagesQueued;        // Other UBX frames that were copied into the message queue
+    uint32_t messagesDropped;       // Other UBX frames that were dropped as the message queue was full
+    uint32_t peakMessages;          // The most UBX messages that have been waiting at once
+    uint32_t maxTime[STAGE_COUNT];  // The longest a single call to each stage has taken, if a clock is given
+};
+
+/**
+ * A parsed sentence or UBX fix message waiting to be published (only one of `parsed` and `message` is
+ * set). The frame is copied out of the receive ring, so the ring is not held up by a slow consumer and
+ * the lazily decoded fields of the sentence, or the payload of the message, stay valid until it has been
+ * published.
+ */
+struct SentenceSlot
+{
+    char line[PIPELINE_MAX_LINE_LENGTH];
+    std::optional<ParsedSentence> parsed;
+    std::optional<ParsedMessage> message;
+};
+
+/**
+ * A complete UBX message (from the sync characters to the checksum) waiting for its consumer, copied out of
+ * the receive ring so that it is contiguous and does not hold up the ring.
+ */
+struct MessageSlot
+{
+    uint8_t message[FRAMER_MAX_FRAME_SIZE];
+    uint16_t length;
+};
+
+/**
+ * Moves the received bytes through the stages of the receive path, each with a bounded queue after it:
+ *
+ *  1. receive - the UART (eg. circular DMA) writes into the receive ring.
+ *  2. frame   - the framer classifies each new byte once, into NMEA frames, UBX frames or garbage, and
+ *               queues the complete frames in the frame queue (`receiveStage`).
+ *  3. parse   - each frame is routed to the queue of its consumer (`parseStage`): each NMEA frame and
+ *               UBX fix message (eg. NAV-PVT) is copied out of the ring and parsed into the sentence
+ *               queue, and every other UBX frame is copied into the message queue.
+ *  4. publish - each sentence and fix message is handed to the consumers of the dispatcher, which produce
+ *               the fix output (`publishStage`), whereas each other UBX message is taken by its own
+ *               consumer (`peekMessage`).
+ *
+ * Each stage only does a bounded amount of work per call (its budget), so no stage can starve the others,
+ * and each queue has a policy for when it is full (`StagePolicy`): waiting pushes the backpressure back up
+ * the pipeline, whereas dropping keeps the earlier stages running at the cost of output. The message queue
+ * always drops, so UBX messages that are not consumed never hold up the NMEA sentences.
+ *
+ * On bare metal, the stages are run cooperatively from the main loop with `poll`. On Linux, each stage can
+ * run in its own thread, as each queue has exactly one producer and one consumer:
+```
+Pipeline<2048> pipeline(framer, dispatcher);
+
+while (1) { pipeline.poll(); }      // Bare metal
+
+std::thread frame([&] { while (running) { if (pipeline.receiveStage() == 0) std::this_thread::yield(); } });
+std::thread parse([&] { while (running) { if (pipeline.parseStage() == 0) std::this_thread::yield(); } });
+std::thread publish([&] { while (running) { if (pipeline.publishStage() == 0) std::this_thread::yield(); } });
+
+const MessageSlot * message;
+while ((message = pipeline.peekMessage()) != NULL) { ...; pipeline.popMessage(); }
+```
+ */
+template <size_t capacity, typename Storage = RingStorage<uint8_t, capacity>> class Pipeline
+{
+    public:
+    Pipeline(Framer<capacity, Storage>& framer, SentenceDispatcher& dispatcher, StagePolicy framePolicy = STAGE_WAIT, StagePolicy sentencePolicy = STAGE_WAIT, PipelineClock clock = NULL);
+
+    size_t receiveStage(size_t budget = PIPELINE_FRAME_BUDGET);
+    size_t parseStage(size_t budget = PIPELINE_PARSE_BUDGET);
+    size_t publishStage(size_t budget = PIPELINE_PUBLISH_BUDGET);
+    bool poll();
+
+    const MessageSlot * const peekMessage();
+    void popMessage();
+
+    PipelineStats getStats();
+
+    private:
+    Framer<capacity, Storage>& framer;
+    SentenceDispatcher& dispatcher;
+    StagePolicy sentencePolicy;
+    PipelineClock clock;
+
+    SpscRing<SentenceSlot, PIPELINE_QUEUE_LENGTH> sentences;
+    SpscRing<MessageSlot, PIPELINE_MESSAGE_QUEUE_LENGTH> messages;
+
+    std::atomic<uint32_t> nParsed{0};
+    std::atomic<uint32_t> nSkipped{0};
+    std::atomic<uint32_t> nDropped{0};
+    std::atomic<uint32_t> nInvalid{0};
+    std::atomic<uint32_t> nPublished{0};
+    std::atomic<uint32_t> nStalls{0};
+    std::atomic<uint32_t> nMessages{0};
+    std::atomic<uint32_t> nMessagesDropped{0};
+    std::atomic<uint32_t> maxTime[STAGE_COUNT] = {};
+
+    bool parseFrame(const FrameView& frame);
+    void queueMessage(const FrameView& frame);
+
+    uint32_t startTimer();
+    void stopTimer(PipelineStage stage, uint32_t start);
+};
+
+/* Include the template implementation after declaration
+ * NOTE: This is done as templates must either be fully defined in the header
+ *       or have specific implementations specified. To circumvent this, a file
+ *       with the template implementation can be included in the header to include
+ *       the implementation. This reduces the code in the header file.
+ * NOTE: Do NOT include pipeline.tpp at the beginning of this file or at any point
+ *       in other header files.
+ * REFERENCE: https://stackoverflow.com/questions/495021/why-can-templates-only-be-implemented-in-the-header-file
+ * REFERENCE: https://isocpp.org/wiki/faq/templates#templates-defn-vs-decl
+ */
+#include "pipeline.tpp"
+
+#endif
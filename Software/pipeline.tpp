@@ -0,0 +1,301 @@
+/**
+ * FILE: pipeline.tpp
+ * PURPOSE: To serve as the template implementation file for the pipeline declared in pipeline.hpp
+ *
+ * UPDATED: 17 Oct. 2026
+ *
+ * NOTE: Do NOT include this file other than at the end of pipeline.hpp.
+ *       Any other includes may lead to issues.
+ */
+
+/* ------------------------ Pipeline Definitions ------------------------ */
+
+/**
+ * Creates a pipeline from the given framer to the consumers of the given dispatcher.
+ *
+ * @param framer The framer of the receive ring, which becomes the frame stage.
+ * @param dispatcher The dispatcher that hands each sentence to its consumers, which becomes the publish stage.
+ * @param framePolicy What the frame stage does when the frame queue is full.
+ * @param sentencePolicy What the parse stage does when the sentence queue is full.
+ * @param clock The clock used to time each stage, or NULL to not time the stages.
+ */
+template <size_t capacity, typename Storage>
+Pipeline<capacity, Storage>::Pipeline(Framer<capacity, Storage>& framer, SentenceDispatcher& dispatcher, StagePolicy framePolicy, StagePolicy sentencePolicy, PipelineClock clock)
+    : framer(framer), dispatcher(dispatcher), sentencePolicy(sentencePolicy), clock(clock)
+{
+    this->framer.setPolicy(framePolicy);
+}
+
+/**
+ * Runs the frame stage - scans at most `budget` newly received bytes into the frame queue.
+ *
+ * @returns The number of bytes that were scanned.
+ */
+template <size_t capacity, typename Storage>
+size_t Pipeline<capacity, Storage>::receiveStage(size_t budget)
+{
+    uint32_t start = this->startTimer();
+    size_t scanned = this->framer.receive(budget);
+
+    this->stopTimer(STAGE_FRAME, start);
+
+    return scanned;
+}
+
+/**
+ * Runs the parse stage - routes at most `budget` frames from the frame queue to the queue of their
+ * consumer. Each NMEA frame and UBX fix message is copied out of the receive ring and parsed into the
+ * sentence queue (only the sentence types that the consumers accept are parsed), and every other UBX
+ * frame is copied into the message queue.
+ *
+ * @returns The number of frames that were taken from the frame queue.
+ */
+template <size_t capacity, typename Storage>
+size_t Pipeline<capacity, Storage>::parseStage(size_t budget)
+{
+    uint32_t start = this->startTimer();
+    size_t n = 0;
+    FrameView frame;
+
+    while (n < budget && this->framer.peek(frame))
+    {
+        if (frame.type == FRAME_UBX && ParsedMessage::classify(getFrameByte(frame, 2), getFrameByte(frame, 3)) == UBX_INV)
+        {
+            this->queueMessage(frame);
+        }
+        else if (!this->parseFrame(frame))
+        {
+            /* The frame stays queued, so the frame stage will wait in turn */
+            this->nStalls.fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+
+        this->framer.pop();
+        n++;
+    }
+
+    this->stopTimer(STAGE_PARSE, start);
+
+    return n;
+}
+
+/**
+ * Runs the publish stage - hands at most `budget` parsed sentences to the consumers of the dispatcher.
+ *
+ * @returns The number of sentences that were published.
+ */
+template <size_t capacity, typename Storage>
+size_t Pipeline<capacity, Storage>::publishStage(size_t budget)
+{
+    uint32_t start = this->startTimer();
+    size_t n = 0;
+
+    while (n < budget)
+    {
+        RingSegment<const SentenceSlot> slot = this->sentences.getReadSegment();
+
+        if (slot.length == 0)
+        {
+            break;
+        }
+
+        /* The consumers receive a mutable sentence, as the lazy fields are decoded when they are read */
+        SentenceSlot& sentence = const_cast<SentenceSlot&>(slot.data[0]);
+
+        if (sentence.parsed.has_value())
+        {
+            this->dispatcher.publish(*sentence.parsed);
+            sentence.parsed.reset();
+        }
+        else
+        {
+            this->dispatcher.publish(*sentence.message);
+            sentence.message.reset();
+        }
+
+        this->sentences.commitRead(1);
+        this->nPublished.fetch_add(1, std::memory_order_relaxed);
+        n++;
+    }
+
+    this->stopTimer(STAGE_PUBLISH, start);
+
+    return n;
+}
+
+/**
+ * Runs each stage once, within its default budget, from the end of the pipeline to the start, so that
+ * each stage makes room for the one before it.
+ *
+ * @returns `true` if any stage did some work, or `false` if the pipeline is idle.
+ */
+template <size_t capacity, typename Storage>
+bool Pipeline<capacity, Storage>::poll()
+{
+    size_t n = 0;
+
+    n += this->publishStage();
+    n += this->parseStage();
+    n += this->receiveStage();
+
+    return n > 0;
+}
+
+/**
+ * Returns the oldest UBX message in the message queue, without removing it, or NULL if the queue is empty.
+ * The message stays valid until it is popped.
+ */
+template <size_t capacity, typename Storage>
+const MessageSlot * const Pipeline<capacity, Storage>::peekMessage()
+{
+    RingSegment<const MessageSlot> slot = this->messages.getReadSegment();
+
+    return slot.length > 0 ? slot.data : NULL;
+}
+
+/* Removes the oldest UBX message from the message queue, once it has been used */
+template <size_t capacity, typename Storage>
+void Pipeline<capacity, Storage>::popMessage()
+{
+    if (this->messages.getSize() > 0)
+    {
+        this->messages.commitRead(1);
+    }
+}
+
+/* Returns the counters of the pipeline (see `PipelineStats`) */
+template <size_t capacity, typename Storage>
+PipelineStats Pipeline<capacity, Storage>::getStats()
+{
+    PipelineStats stats = {};
+    uint8_t i;
+
+    stats.framesParsed = this->nParsed.load(std::memory_order_relaxed);
+    stats.framesSkipped = this->nSkipped.load(std::memory_order_relaxed);
+    stats.framesDropped = this->nDropped.load(std::memory_order_relaxed);
+    stats.sentencesInvalid = this->nInvalid.load(std::memory_order_relaxed);
+    stats.sentencesPublished = this->nPublished.load(std::memory_order_relaxed);
+    stats.stalls = this->nStalls.load(std::memory_order_relaxed);
+    stats.peakSentences = this->sentences.getPeak();
+    stats.messagesQueued = this->nMessages.load(std::memory_order_relaxed);
+    stats.messagesDropped = this->nMessagesDropped.load(std::memory_order_relaxed);
+    stats.peakMessages = this->messages.getPeak();
+
+    for (i = 0; i < STAGE_COUNT; i++)
+    {
+        stats.maxTime[i] = this->maxTime[i].load(std::memory_order_relaxed);
+    }
+
+    return stats;
+}
+
+/**
+ * Copies the given NMEA frame or UBX fix message out of the receive ring and parses it into the sentence
+ * queue.
+ *
+ * @returns `false` if the sentence queue is full and the policy is `STAGE_WAIT`, in which case the frame
+ *          must be parsed again later, otherwise `true` (the frame has been used, whether or not it was
+ *          queued).
+ */
+template <size_t capacity, typename Storage>
+bool Pipeline<capacity, Storage>::parseFrame(const FrameView& frame)
+{
+    RingSegment<SentenceSlot> slot = this->sentences.getWriteSegment();
+
+    if (frame.length > PIPELINE_MAX_LINE_LENGTH)
+    {
+        this->nSkipped.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (slot.length == 0 && this->sentencePolicy == STAGE_WAIT)
+    {
+        return false;
+    }
+    else if (slot.length == 0)
+    {
+        this->nDropped.fetch_add(1, std::memory_order_relaxed);
+    }
+    else
+    {
+        memcpy(slot.data->line, frame.segments[0].data, frame.segments[0].length);
+        memcpy(slot.data->line + frame.segments[0].length, frame.segments[1].data, frame.segments[1].length);
+
+        bool valid;
+
+        if (frame.type == FRAME_NMEA)
+        {
+            slot.data->parsed.emplace(slot.data->line, frame.length, this->dispatcher.getInterests());
+            valid = slot.data->parsed->getType() != NMEA_INV;
+        }
+        else
+        {
+            slot.data->message.emplace((const uint8_t *) slot.data->line, frame.length);
+            valid = slot.data->message->getType() != UBX_INV;
+        }
+
+        if (valid)
+        {
+            this->sentences.commitWrite(1);
+            this->nParsed.fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            /* The slot is reused for the next frame, which may be of the other type */
+            slot.data->parsed.reset();
+            slot.data->message.reset();
+            this->nInvalid.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    return true;
+}
+
+/**
+ * Copies the given UBX frame out of the receive ring into the message queue, or drops it if the queue is
+ * full.
+ */
+template <size_t capacity, typename Storage>
+void Pipeline<capacity, Storage>::queueMessage(const FrameView& frame)
+{
+    RingSegment<MessageSlot> slot = this->messages.getWriteSegment();
+
+    if (slot.length == 0)
+    {
+        this->nMessagesDropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    memcpy(slot.data->message, frame.segments[0].data, frame.segments[0].length);
+    memcpy(slot.data->message + frame.segments[0].length, frame.segments[1].data, frame.segments[1].length);
+    slot.data->length = frame.length;
+
+    this->messages.commitWrite(1);
+    this->nMessages.fetch_add(1, std::memory_order_relaxed);
+}
+
+/* Returns the time that a stage started, or 0 if the stages are not timed */
+template <size_t capacity, typename Storage>
+uint32_t Pipeline<capacity, Storage>::startTimer()
+{
+    return this->clock != NULL ? this->clock() : 0;
+}
+
+/* Records the time taken by a stage, if it is the longest so far */
+template <size_t capacity, typename Storage>
+void Pipeline<capacity, Storage>::stopTimer(PipelineStage stage, uint32_t start)
+{
+    uint32_t elapsed;
+
+    if (this->clock == NULL)
+    {
+        return;
+    }
+
+    elapsed = this->clock() - start;
+
+    if (elapsed > this->maxTime[stage].load(std::memory_order_relaxed))
+    {
+        this->maxTime[stage].store(elapsed, std::memory_order_relaxed);
+    }
+}
+
+/* ---------------------- End Pipeline Definitions ---------------------- */
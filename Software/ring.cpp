@@ -0,0 +1,77 @@
+#include "ring.hpp"
+
+#ifdef __linux__
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+/* ------------------------ Mirroring Definitions ----------------------- */
+
+/**
+ * Maps `size` bytes of anonymous shared memory twice, back to back, so that the byte at `data[i + size]`
+ * is the byte at `data[i]`.
+ *
+ * @param size The number of bytes to map. This must be a multiple of the page size.
+ *
+ * @returns The start of the first mapping, or NULL if the memory could not be mapped.
+ */
+void * mapMirrored(size_t size)
+{
+    int fd;
+    uint8_t * data;
+
+    if (size == 0 || size % (size_t) sysconf(_SC_PAGESIZE) != 0)
+    {
+        return NULL;
+    }
+
+    fd = memfd_create("ring", 0);
+
+    if (fd < 0)
+    {
+        return NULL;
+    }
+
+    if (ftruncate(fd, (off_t) size) != 0)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    /* Reserve both halves at once, so that the second mapping is guaranteed to follow the first */
+    data = (uint8_t *) mmap(NULL, 2 * size, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (data == MAP_FAILED)
+    {
+        close(fd);
+        return NULL;
+    }
+
+    if (mmap(data, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED
+        || mmap(data + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        munmap(data, 2 * size);
+        close(fd);
+        return NULL;
+    }
+
+    /* The mappings keep the memory alive */
+    close(fd);
+
+    return data;
+}
+
+/**
+ * Unmaps memory that was mapped by `mapMirrored`.
+ */
+void unmapMirrored(void * data, size_t size)
+{
+    if (data != NULL)
+    {
+        munmap(data, 2 * size);
+    }
+}
+
+/* ---------------------- End Mirroring Definitions --------------------- */
+
+#endif
@@ -0,0 +1,157 @@
+/**
+ * FILE: ring.hpp
+ * PURPOSE: To declare the lock-free single-producer/single-consumer ring buffer that is used to pass
+ *          data between an interrupt (or thread) and the main loop.
+ *
+ * UPDATED: 17 Oct. 2026
+ */
+
+#ifndef INC_RING_HPP_
+#define INC_RING_HPP_
+
+#include <atomic>
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * A contiguous section of a ring buffer. The section may be shorter than the data that is available,
+ * as the data may continue from the start of the buffer.
+ */
+template <typename T> struct RingSegment
+{
+    T * data;       // The start of the section
+    size_t length;  // The number of elements in the section
+};
+
+/**
+ * The default storage of a ring buffer - a plain array inside the ring.
+ */
+template <typename T, size_t capacity> struct RingStorage
+{
+    static constexpr bool MIRRORED = false;
+
+    T data[capacity];
+};
+
+#ifdef __linux__
+
+void * mapMirrored(size_t size);
+void unmapMirrored(void * data, size_t size);
+
+/**
+ * The storage of a ring buffer on Linux, where the same memory is mapped twice, back to back, so that
+ * `data[i + capacity]` is `data[i]`. Any section of the ring, even one that wraps around the end, can then
+ * be used as one contiguous array, so the users of the ring never need to handle the wrap.
+ *
+ * @note The size of the storage (`capacity * sizeof(T)`) must be a multiple of the page size. If the
+ *       memory cannot be mapped, `data` is NULL, which can be checked with `SpscRing::getBuffer`.
+ */
+template <typename T, size_t capacity> struct MirroredRingStorage
+{
+    static constexpr bool MIRRORED = true;
+
+    T * const data;
+
+    MirroredRingStorage();
+    ~MirroredRingStorage();
+
+    MirroredRingStorage(const MirroredRingStorage&) = delete;
+    MirroredRingStorage& operator=(const MirroredRingStorage&) = delete;
+};
+
+#endif
+
+/**
+ * A lock-free ring buffer for one producer and one consumer, which may run in different contexts (eg.
+ * the UART receive callback and the main loop, or two threads). Only the producer writes `head` and only
+ * the consumer writes `tail`, so no locks are needed. The indices are published with release ordering and
+ * read with acquire ordering, so the data written before an index is updated is always visible to the
+ * other side once it sees the new index.
+ *
+ * The indices count every element that has been written or read and are only wrapped to the capacity
+ * when the buffer is accessed, so the buffer can be completely filled and the amount of data never needs
+ * to be guessed. The capacity must be a power of 2, so wrapping is a single mask.
+ *
+ * As well as copying `write` and `read`, the buffer can be accessed in place using contiguous segments:
+```
+RingSegment<uint8_t> segment = ring.getWriteSegment();
+size_t n = receive(segment.data, segment.length);
+ring.commitWrite(n);
+
+RingSegment<const uint8_t> segment = ring.getReadSegment();
+process(segment.data, segment.length);
+ring.commitRead(segment.length);
+```
+ *
+ * Unread data can also be viewed without being read, as at most two segments (the part before the end
+ * of the buffer and the part that continues from the start) using `getReadSegments`, or by its position
+ * in the stream of written elements using `getSegmentsAt`.
+ *
+ * A producer that writes around the whole buffer by itself (eg. a circular DMA transfer) can write into
+ * `getBuffer` directly and publish what it has written with `commitWrite`. Such a producer cannot be
+ * stopped when the buffer is full, so it may overwrite unread data - the consumer then only ever sees the
+ * most recent `capacity` elements, and must discard what it has (see `Framer::discard`).
+ *
+ * The producer keeps count of the elements that are lost (`getDropped`) and of the most elements that
+ * have been unread at once (`getPeak`), so the capacity can be sized from real traffic.
+ *
+ * On Linux, the ring can use `MirroredRingStorage`, in which case every segment is contiguous - a
+ * segment is never cut short by the end of the buffer and the second segment from `getReadSegments` is
+ * always empty.
+ *
+ * @note Only standard C++ is used, so the same buffer can be built and stress-tested on Linux.
+ */
+template <typename T, size_t capacity, typename Storage = RingStorage<T, capacity>> class SpscRing
+{
+    static_assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Ensure that the capacity is a power of 2");
+    static_assert(capacity <= ((size_t) 1 << 31), "Ensure that the capacity can be counted by the indices");
+
+    public:
+    static constexpr size_t CAPACITY = capacity;
+
+    size_t getSize();
+    size_t getSpace();
+
+    uint32_t getDropped();
+    uint32_t getPeak();
+
+    /* Producer only */
+    T * const getBuffer();
+    size_t write(const T * data, size_t length);
+    RingSegment<T> getWriteSegment();
+    void commitWrite(size_t length);
+
+    /* Consumer only */
+    size_t read(T * data, size_t length);
+    RingSegment<const T> getReadSegment();
+    size_t getReadSegments(size_t offset, size_t length, RingSegment<const T> segments[2]);
+    void commitRead(size_t length);
+
+    /* Either side, for elements that are known to be written and not yet read */
+    void getSegmentsAt(uint32_t position, size_t length, RingSegment<const T> segments[2]);
+
+    private:
+    static constexpr uint32_t MASK = capacity - 1;
+
+    Storage storage;
+    std::atomic<uint32_t> head{0};  // The number of elements that have been written
+    std::atomic<uint32_t> tail{0};  // The number of elements that have been read
+
+    std::atomic<uint32_t> nDropped{0};  // Elements that did not fit or were overwritten before being read
+    std::atomic<uint32_t> peak{0};      // The most elements that have been unread at once
+};
+
+/* Include the template implementation after declaration
+ * NOTE: This is done as templates must either be fully defined in the header
+ *       or have specific implementations specified. To circumvent this, a file
+ *       with the template implementation can be included in the header to include
+ *       the implementation. This reduces the code in the header file.
+ * NOTE: Do NOT include ring.tpp at the beginning of this file or at any point
+ *       in other header files.
+ * REFERENCE: https://stackoverflow.com/questions/495021/why-can-templates-only-be-implemented-in-the-header-file
+ * REFERENCE: https://isocpp.org/wiki/faq/templates#templates-defn-vs-decl
+ */
+#include "ring.tpp"
+
+#endif
@@ -0,0 +1,298 @@
+/**
+ * FILE: ring.tpp
+ * PURPOSE: To serve as the template implementation file for the ring buffer declared in ring.hpp
+ *
+ * UPDATED: 17 Oct. 2026
+ *
+ * NOTE: Do NOT include this file other than at the end of ring.hpp.
+ *       Any other includes may lead to issues.
+ */
+
+/* -------------------- MirroredRingStorage Definitions ------------------- */
+
+#ifdef __linux__
+
+/**
+ * Maps the storage twice, back to back. If the mapping fails, `data` is NULL.
+ */
+template <typename T, size_t capacity>
+MirroredRingStorage<T, capacity>::MirroredRingStorage() : data((T *) mapMirrored(capacity * sizeof(T)))
+{
+
+}
+
+template <typename T, size_t capacity>
+MirroredRingStorage<T, capacity>::~MirroredRingStorage()
+{
+    unmapMirrored(this->data, capacity * sizeof(T));
+}
+
+#endif
+
+/* ------------------ End MirroredRingStorage Definitions ----------------- */
+
+
+/* ------------------------ SpscRing Definitions ------------------------ */
+
+/**
+ * Returns the number of elements that can be read. This is exact for the consumer, whereas the producer
+ * may only see fewer elements than there are.
+ */
+template <typename T, size_t capacity, typename Storage>
+size_t SpscRing<T, capacity, Storage>::getSize()
+{
+    return (uint32_t) (this->head.load(std::memory_order_acquire) - this->tail.load(std::memory_order_acquire));
+}
+
+/**
+ * Returns the number of elements that can be written. This is exact for the producer, whereas the
+ * consumer may only see less space than there is.
+ */
+template <typename T, size_t capacity, typename Storage>
+size_t SpscRing<T, capacity, Storage>::getSpace()
+{
+    size_t size = this->getSize();
+
+    /* A producer that cannot be stopped (see `getBuffer`) may have overrun the consumer */
+    return size < capacity ? capacity - size : 0;
+}
+
+/**
+ * Returns the whole buffer, for a producer that writes around the buffer by itself (eg. a circular DMA
+ * transfer). The element at index `i` is at stream position `i` modulo the capacity, and the elements
+ * that are written are published with `commitWrite`.
+ */
+template <typename T, size_t capacity, typename Storage>
+T * const SpscRing<T, capacity, Storage>::getBuffer()
+{
+    return this->storage.data;
+}
+
+/**
+ * Copies as many of the given elements into the buffer as there is space for. Any elements that do not
+ * fit are counted as dropped.
+ *
+ * @param data The elements to write.
+ * @param length The number of elements to write.
+ *
+ * @returns The number of elements that were written.
+ */
+template <typename T, size_t capacity, typename Storage>
+size_t SpscRing<T, capacity, Storage>::write(const T * data, size_t length)
+{
+    size_t written = 0;
+
+    /* The free space is at most two segments - up to the end of the buffer, then from the start */
+    while (written < length)
+    {
+        RingSegment<T> segment = this->getWriteSegment();
+        size_t n = segment.length < length - written ? segment.length : length - written;
+        size_t i;
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            segment.data[i] = data[written + i];
+        }
+
+        this->commitWrite(n);
+        written += n;
+    }
+
+    this->nDropped.fetch_add((uint32_t) (length - written), std::memory_order_relaxed);
+
+    return written;
+}
+
+/**
+ * Returns the contiguous free space after the last written element, which can be written in place and
+ * then published with `commitWrite`.
+ *
+ * @returns The free segment, which has a length of 0 if the buffer is full.
+ */
+template <typename T, size_t capacity, typename Storage>
+RingSegment<T> SpscRing<T, capacity, Storage>::getWriteSegment()
+{
+    uint32_t head = this->head.load(std::memory_order_relaxed);
+    uint32_t tail = this->tail.load(std::memory_order_acquire);
+    size_t size = (uint32_t) (head - tail);
+    size_t space = size < capacity ? capacity - size : 0;
+    size_t untilEnd = Storage::MIRRORED ? capacity : capacity - (head & MASK);
+
+    return {this->storage.data + (head & MASK), space < untilEnd ? space : untilEnd};
+}
+
+/**
+ * Publishes elements that were written in place to the consumer.
+ *
+ * @param length The number of elements that were written. This must not be more than the length of the
+ *               last segment from `getWriteSegment`.
+ */
+template <typename T, size_t capacity, typename Storage>
+void SpscRing<T, capacity, Storage>::commitWrite(size_t length)
+{
+    uint32_t head = this->head.load(std::memory_order_relaxed) + (uint32_t) length;
+    size_t size = (uint32_t) (head - this->tail.load(std::memory_order_acquire));
+
+    /* A producer that cannot be stopped (see `getBuffer`) overwrites the oldest unread elements */
+    if (size > capacity)
+    {
+        this->nDropped.fetch_add((uint32_t) (size - capacity < length ? size - capacity : length), std::memory_order_relaxed);
+        size = capacity;
+    }
+
+    if (size > this->peak.load(std::memory_order_relaxed))
+    {
+        this->peak.store((uint32_t) size, std::memory_order_relaxed);
+    }
+
+    this->head.store(head, std::memory_order_release);
+}
+
+/**
+ * Copies as many elements out of the buffer as are available, up to the given length.
+ *
+ * @param data The array to copy the elements to.
+ * @param length The maximum number of elements to read.
+ *
+ * @returns The number of elements that were read.
+ */
+template <typename T, size_t capacity, typename Storage>
+size_t SpscRing<T, capacity, Storage>::read(T * data, size_t length)
+{
+    size_t nRead = 0;
+
+    /* The available data is at most two segments - up to the end of the buffer, then from the start */
+    while (nRead < length)
+    {
+        RingSegment<const T> segment = this->getReadSegment();
+        size_t n = segment.length < length - nRead ? segment.length : length - nRead;
+        size_t i;
+
+        if (n == 0)
+        {
+            break;
+        }
+
+        for (i = 0; i < n; i++)
+        {
+            data[nRead + i] = segment.data[i];
+        }
+
+        this->commitRead(n);
+        nRead += n;
+    }
+
+    return nRead;
+}
+
+/**
+ * Returns the contiguous data after the last read element, which can be used in place and then released
+ * with `commitRead`.
+ *
+ * @returns The available segment, which has a length of 0 if the buffer is empty.
+ */
+template <typename T, size_t capacity, typename Storage>
+RingSegment<const T> SpscRing<T, capacity, Storage>::getReadSegment()
+{
+    uint32_t tail = this->tail.load(std::memory_order_relaxed);
+    uint32_t head = this->head.load(std::memory_order_acquire);
+    size_t available = (uint32_t) (head - tail);
+    size_t untilEnd = Storage::MIRRORED ? capacity : capacity - (tail & MASK);
+
+    return {this->storage.data + (tail & MASK), available < untilEnd ? available : untilEnd};
+}
+
+/**
+ * Views a section of the unread data in place, without reading it. The section is returned as at most
+ * two segments, as it may continue from the start of the buffer.
+ *
+ * @param offset The number of unread elements to skip before the section.
+ * @param length The maximum number of elements in the section.
+ * @param segments The segments of the section. The second segment has a length of 0 if the section does
+ *                 not wrap around the end of the buffer.
+ *
+ * @returns The number of elements in the section, which is less than `length` if there are not enough
+ *          unread elements.
+ */
+template <typename T, size_t capacity, typename Storage>
+size_t SpscRing<T, capacity, Storage>::getReadSegments(size_t offset, size_t length, RingSegment<const T> segments[2])
+{
+    uint32_t tail = this->tail.load(std::memory_order_relaxed);
+    uint32_t head = this->head.load(std::memory_order_acquire);
+    size_t available = (uint32_t) (head - tail);
+    uint32_t start = (tail + (uint32_t) offset) & MASK;
+
+    /* If the producer has overrun the consumer, only the most recent elements are still in the buffer */
+    if (available > capacity)
+    {
+        available = capacity;
+    }
+
+    size_t untilEnd = Storage::MIRRORED ? capacity : capacity - start;
+
+    length = offset < available ? (length < available - offset ? length : available - offset) : 0;
+
+    segments[0] = {this->storage.data + start, length < untilEnd ? length : untilEnd};
+    segments[1] = {this->storage.data, length - segments[0].length};
+
+    return length;
+}
+
+/**
+ * Views elements by their position in the stream of elements (ie. the number of elements that were
+ * written before them), as at most two segments. Unlike `getReadSegments`, the indices are not read, so
+ * this can be used by either side as long as the elements are known to have been written and not read,
+ * eg. by a thread that is handed positions by the producer and hands them back before they are read.
+ *
+ * @param position The position of the first element.
+ * @param length The number of elements.
+ * @param segments The segments of the elements. The second segment has a length of 0 if the elements
+ *                 do not wrap around the end of the buffer.
+ */
+template <typename T, size_t capacity, typename Storage>
+void SpscRing<T, capacity, Storage>::getSegmentsAt(uint32_t position, size_t length, RingSegment<const T> segments[2])
+{
+    uint32_t start = position & MASK;
+    size_t untilEnd = Storage::MIRRORED ? capacity : capacity - start;
+
+    segments[0] = {this->storage.data + start, length < untilEnd ? length : untilEnd};
+    segments[1] = {this->storage.data, length - segments[0].length};
+}
+
+/**
+ * Releases elements that have been read in place, so that their space can be written again.
+ *
+ * @param length The number of elements that were read. This must not be more than the length of the
+ *               last segment from `getReadSegment`.
+ */
+template <typename T, size_t capacity, typename Storage>
+void SpscRing<T, capacity, Storage>::commitRead(size_t length)
+{
+    this->tail.store(this->tail.load(std::memory_order_relaxed) + (uint32_t) length, std::memory_order_release);
+}
+
+/**
+ * Returns the number of elements that have been lost, either as they did not fit when written or as they
+ * were overwritten before they were read.
+ */
+template <typename T, size_t capacity, typename Storage>
+uint32_t SpscRing<T, capacity, Storage>::getDropped()
+{
+    return this->nDropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * Returns the most elements that have been waiting to be read at once, as seen by the producer.
+ */
+template <typename T, size_t capacity, typename Storage>
+uint32_t SpscRing<T, capacity, Storage>::getPeak()
+{
+    return this->peak.load(std::memory_order_relaxed);
+}
+
+/* ---------------------- End SpscRing Definitions ---------------------- */
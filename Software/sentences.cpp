@@ -1,125 +1,286 @@
 #include "sentences.hpp"
 
-const std::vector<std::string> BASE::acceptedTypes = {
-    "DTM", "GAQ", "GBQ", "GBS", "GGA", "GLL", "GLQ", "GNQ", "GNS", "GPQ",
-    "GRS", "GSA", "GST", "GSV", "RLM", "RMC", "TXT", "VLW", "VTG", "ZDA"
-};
-const std::vector<std::string> STD_MSG_POLL::acceptedTypes = {"GAQ", "GBQ", "GLQ", "GNQ", "GPQ"};
-const std::vector<std::string> POS::acceptedTypes = {"DTM", "GGA", "GLL", "GNS", "RMC"};
-const std::vector<std::string> ALTITUDE::acceptedTypes = {"DTM", "GGA", "GNS"};
-const std::vector<std::string> POS3D::acceptedTypes = {"DTM", "GGA", "GNS"};
-const std::vector<std::string> TIME::acceptedTypes = {"GBS", "GGA", "GLL", "GNS", "GRS", "GST", "RLM", "RMC", "ZDA"};
-const std::vector<std::string> DTM::acceptedTypes = {"DTM"};
-const std::vector<std::string> GAQ::acceptedTypes = {"GAQ"};
-const std::vector<std::string> GBQ::acceptedTypes = {"GBQ"};
-const std::vector<std::string> GBS::acceptedTypes = {"GBS"};
-const std::vector<std::string> GGA::acceptedTypes = {"GGA"};
-const std::vector<std::string> GLL::acceptedTypes = {"GLL"};
-const std::vector<std::string> GLQ::acceptedTypes = {"GLQ"};
-const std::vector<std::string> GNQ::acceptedTypes = {"GNQ"};
-const std::vector<std::string> GNS::acceptedTypes = {"GNS"};
-const std::vector<std::string> GPQ::acceptedTypes = {"GPQ"};
-const std::vector<std::string> GRS::acceptedTypes = {"GRS"};
-const std::vector<std::string> GSA::acceptedTypes = {"GSA"};
-const std::vector<std::string> GST::acceptedTypes = {"GST"};
-const std::vector<std::string> GSV::acceptedTypes = {"GSV"};
-const std::vector<std::string> RLM::acceptedTypes = {"RLM"};
-const std::vector<std::string> RMC::acceptedTypes = {"RMC"};
-const std::vector<std::string> TXT::acceptedTypes = {"TXT"};
-const std::vector<std::string> VLW::acceptedTypes = {"VLW"};
-const std::vector<std::string> VTG::acceptedTypes = {"VTG"};
-const std::vector<std::string> ZDA::acceptedTypes = {"ZDA"};
+/* ------------------------ NMEALine Definitions ------------------------ */
 
-/* -------------------------- BASE Definitions -------------------------- */
-
-BASE::BASE(char ** lineArr, uint16_t length)
+/**
+ * Converts a single hexadecimal character to its value.
+ *
+ * @returns The value of the character (0-15), or -1 if it is not a hexadecimal character.
+ */
+static inline int8_t hexValue(char c)
 {
+    if (c >= '0' && c <= '9')
+        return c - '0';
 
+    if (c >= 'A' && c <= 'F')
+        return c - 'A' + 10;
+
+    if (c >= 'a' && c <= 'f')
+        return c - 'a' + 10;
+
+    return -1;
 }
 
 /**
- * Initialises the sentence data using the specific override functions implemented by the individual
- * sentence classes.
- * 
- * @param lineArr The array of the string sentence split at each ',' character.
- * @param length The length of the lineArr.
- * 
- * @returns `true` if the object has been successfully initialised, `false` otherwise.
+ * Verifies the format of the given NMEA sentence, verifies its checksum and splits it into its fields.
+ * This is all done in a single pass over the sentence and without allocating any memory.
+ *
+ * The sentence must be of the format: $TTSSS,<fields>*hh with an optional "\r\n" at the end, where
+ *      TT -> The talker ID (digits or capital letters)
+ *      SSS -> The sentence formatter (digits or capital letters)
+ *      hh -> The hexadecimal checksum
+ *
+ * @param data The sentence to scan. The scan ends at either a string terminator ('\0'), or after
+ *             `maxLength` characters, whichever comes first.
+ * @param maxLength The maximum number of characters to scan. Use `SIZE_MAX` for a null terminated string.
+ * @param line The `NMEALine` to populate with the fields and checksum of the sentence.
+ *
+ * @returns 0 if the sentence is valid, -1 if the format is invalid, -2 if an input is NULL, -3 if the
+ *          checksum does not match and -4 if the sentence has more than `NMEA_MAX_FIELDS` fields.
  */
-bool BASE::initialise(char ** lineArr, uint16_t length)
+int8_t scanNMEA(const char * data, size_t maxLength, NMEALine * const line)
 {
-    /* 
-     * Number of fields is length + 2 as the checksum and end delimiter are considered 
-     * as fields, but are not considered in the length of the array 
-     */
-    if(this->verifyBounds(length + 2))  // This ensures parseNMEA does not overstep array bounds
+    size_t i = 0;
+    size_t fieldStart = 0;
+    uint16_t nFields = 0;
+    uint8_t check = 0;
+    int8_t high, low;
+
+    if (data == NULL || line == NULL)
     {
-        this->parseNMEA(lineArr, length);
-        return this->checkValidity();
+        return -2;
     }
-    else
+
+    /* Ensure that the header and checksum can be present, ie. $TTSSS,*hh */
+    if (maxLength < 10 || data[0] != '$')
     {
-        return false;
+        return -1;
+    }
+
+    /* Ensure that the talker ID and sentence formatter are either numeric or capital letters */
+    for (i = 1; i < 6; i++)
+    {
+        if (!isdigit((unsigned char) data[i]) && !isupper((unsigned char) data[i]))
+        {
+            return -1;
+        }
+
+        check ^= (uint8_t) data[i];
+    }
+
+    if (data[6] != ',')
+    {
+        return -1;
+    }
+
+    /* The header field includes the '$' symbol */
+    fieldStart = 0;
+
+    /* Scan the checksum region, recording the fields as they are found */
+    for (i = 6; i < maxLength && data[i] != '*'; i++)
+    {
+        char c = data[i];
+
+        /* The sentence ended before the checksum was found */
+        if (c == '\0' || c == '\r' || c == '\n' || c == '$')
+        {
+            return -1;
+        }
+
+        if (c == ',')
+        {
+            if (nFields < NMEA_MAX_FIELDS)
+            {
+                line->fields[nFields].str = data + fieldStart;
+                line->fields[nFields].length = (uint16_t) (i - fieldStart);
+            }
+
+            nFields++;
+            fieldStart = i + 1;
+        }
+
+        check ^= (uint8_t) c;
+    }
+
+    /* Ensure the '*' exists and is followed by two hexadecimal characters */
+    if (i + 2 >= maxLength || data[i] != '*')
+    {
+        return -1;
+    }
+
+    high = hexValue(data[i + 1]);
+    low = (high < 0) ? -1 : hexValue(data[i + 2]);
+
+    if (low < 0)
+    {
+        return -1;
+    }
+
+    /* Close the final field at the '*' */
+    if (nFields < NMEA_MAX_FIELDS)
+    {
+        line->fields[nFields].str = data + fieldStart;
+        line->fields[nFields].length = (uint16_t) (i - fieldStart);
+    }
+
+    nFields++;
+    i += 3;
+
+    /* The sentence may only be followed by "\r\n" */
+    if (i < maxLength && data[i] != '\0')
+    {
+        if (i + 1 >= maxLength || data[i] != '\r' || data[i + 1] != '\n')
+        {
+            return -1;
+        }
+
+        i += 2;
+
+        if (i < maxLength && data[i] != '\0')
+        {
+            return -1;
+        }
     }
+
+    line->length = nFields;
+    line->checksum = (uint8_t) (high << 4 | low);
+
+    if (line->checksum != check)
+    {
+        return -3;
+    }
+
+    if (nFields > NMEA_MAX_FIELDS)
+    {
+        return -4;
+    }
+
+    return 0;
 }
 
+/* ---------------------- END NMEALine Definitions ---------------------- */
+
+
+/* -------------------- ParsedSentence Definitions ---------------------- */
+
 /**
- * Ensure that the provided sentence is within the required size.
- * 
- * @param nFields The number of fields that the sentence currently has.
+ * Verifies, classifies and parses the given string. If the string is not a valid NMEA sentence, or is a
+ * sentence that is not supported or accepted, the type is `NMEA_INV` and the stored sentence is `NULL`.
  * 
- * @returns `true` if the number of fields is in the required bounds and `false` otherwise.
+ * @param line The string from which to interpret the sentence.
+ * @param maxLength The maximum number of characters of `line` to read (see `scanNMEA`).
+ * @param accepted The sentence types to parse. Any other type is classified, but not parsed.
  */
-bool BASE::verifyBounds(uint16_t nFields)
+ParsedSentence::ParsedSentence(const char * line, size_t maxLength, SentenceMask accepted)
 {
-    std::invalid_argument err("The given sentence length is not within the acceptable bounds.");
-    uint8_t minLength, maxLength;
-    this->getSentenceBounds(&minLength, &maxLength);
-
-    /* If outside the sentence bounds, it is no longer correct */
-    if (nFields < minLength || nFields > maxLength)
-        return false;
+    NMEALine scanned;
 
-    return true;
+    if (scanNMEA(line, maxLength, &scanned) == 0)
+    {
+        this->parse(&scanned, accepted);
+    }
 }
 
 /**
- * Checks whether the current sentence is valid.
+ * Classifies and parses the given, already-scanned, sentence.
  * 
- * @returns `true` if valid and `false` if invalid.
+ * @param line The sentence, as produced by `scanNMEA`.
+ * @param accepted The sentence types to parse. Any other type is classified, but not parsed.
  */
-bool BASE::checkValidity()
+ParsedSentence::ParsedSentence(const NMEALine * const line, SentenceMask accepted)
 {
-    return this->constellation != INVALID;
+    this->parse(line, accepted);
 }
 
 /**
- * Reads the NMEA data and assigns the respective array data to the class fields.
+ * Classifies the given sentence in constant time and, if it is an accepted type, parses it.
  */
-void BASE::parseNMEA(char ** lineArr, uint16_t length)
+void ParsedSentence::parse(const NMEALine * const line, SentenceMask accepted)
 {
-    this->header = std::string(lineArr[0]);
-    this->constellation = convertConstellation(lineArr[0]);
-    this->checksum = strtol(strchr(lineArr[length-1], '*') + 1, NULL, 16);
+    Sentences type = NMEA_ID::getType(line->fields[0].str);
+
+    if ((accepted & NMEA_ID::bit(type)) != 0)
+    {
+        this->sentence = this->createSentence(type, line);
+    }
+
+    this->type = this->sentence != NULL ? type : NMEA_INV;
 }
 
 /**
- * Returns the acceptable size of the array.
+ * Returns the type of the parsed sentence, or `NMEA_INV` if no valid sentence was parsed.
  */
-void BASE::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
+Sentences ParsedSentence::getType()
 {
-    *minLength = 2;
-    *maxLength = 23;
+    return this->type;
 }
 
-Constellation BASE::getConstellation()
+/**
+ * Returns the parsed sentence as its `BASE` type, or `NULL` if no valid sentence was parsed.
+ */
+BASE * const ParsedSentence::getSentence()
 {
-    return this->constellation;
+    return this->sentence;
 }
 
-BASE::~BASE()
+/**
+ * Creates and parses the concrete sentence for the given type in the in-place storage.
+ * 
+ * @returns The parsed sentence, or `NULL` if the type is not supported or the sentence is invalid.
+ */
+BASE * ParsedSentence::createSentence(Sentences type, const NMEALine * const line)
 {
+    switch (type)
+    {
+        case NMEA_DTM: return this->emplace<DTM>(line);
+        case NMEA_GAQ: return this->emplace<GAQ>(line);
+        case NMEA_GBQ: return this->emplace<GBQ>(line);
+        case NMEA_GBS: return this->emplace<GBS>(line);
+        case NMEA_GGA: return this->emplace<GGA>(line);
+        case NMEA_GLL: return this->emplace<GLL>(line);
+        case NMEA_GLQ: return this->emplace<GLQ>(line);
+        case NMEA_GNQ: return this->emplace<GNQ>(line);
+        case NMEA_GNS: return this->emplace<GNS>(line);
+        case NMEA_GPQ: return this->emplace<GPQ>(line);
+        case NMEA_GRS: return this->emplace<GRS>(line);
+        case NMEA_GSA: return this->emplace<GSA>(line);
+        case NMEA_GST: return this->emplace<GST>(line);
+        case NMEA_GSV: return this->emplace<GSV>(line);
+        case NMEA_RLM: return this->emplace<RLM>(line);
+        case NMEA_RMC: return this->emplace<RMC>(line);
+        case NMEA_TXT: return this->emplace<TXT>(line);
+        case NMEA_VLW: return this->emplace<VLW>(line);
+        case NMEA_VTG: return this->emplace<VTG>(line);
+        case NMEA_ZDA: return this->emplace<ZDA>(line);
+        default: return NULL;
+    }
+}
+
+/* ------------------ END ParsedSentence Definitions -------------------- */
+
+
+/* -------------------------- BASE Definitions -------------------------- */
+
+/**
+ * Initialises the data that is common to all sentences (the header, constellation and checksum). This is
+ * called by the schema of the sentence before the fields of the sentence are parsed.
+ * 
+ * @param line The scanned sentence, as produced by `scanNMEA`.
+ * 
+ * @returns `true` if the talker ID of the sentence is valid, `false` otherwise.
+ */
+bool BASE::initialise(const NMEALine * const line)
+{
+    this->header = std::string(line->fields[0].str, line->fields[0].length);
+    this->constellation = NMEA_ID::getConstellation(line->fields[0].str);
+    this->checksum = line->checksum;
+
+    return this->constellation != INVALID;
+}
 
+Constellation BASE::getConstellation()
+{
+    return this->constellation;
 }
 
 /* ------------------------ END BASE Definitions ------------------------ */
@@ -129,6 +290,26 @@ BASE::~BASE()
 /* ----------------------- END GROUP Definitions ------------------------ */
 
 
+/* ---------------------- STD_MSG_POLL Definitions ---------------------- */
+
+STD_MSG_POLL::STD_MSG_POLL(STD_MSG_POLL& msg) : msgId(msg.msgId)
+{
+
+}
+
+STD_MSG_POLL::STD_MSG_POLL()
+{
+
+}
+
+Field<std::string> STD_MSG_POLL::getMessageId()
+{
+    return this->msgId;
+}
+
+/* -------------------- END STD_MSG_POLL Definitions -------------------- */
+
+
 /* -------------------------- POS Definitions --------------------------- */
 
 POS::POS(POS& pos)
@@ -144,33 +325,10 @@ POS::POS()
     
 }
 
-bool POS::checkValidity()
+/* Returns the latitude in 1e-7 degrees (positive if north, negative if south) */
+Field<int32_t> POS::getLatitudeE7()
 {
-    bool valid = true;
-
-    if (this->NS != 'N' && this->NS != 'S')
-        valid = false;
-        
-    if (this->EW != 'E' && this->EW != 'W')
-        valid = false;
-        
-    return valid;
-}
-
-void POS::parseNMEA(char * lat, char * NS, char * lon, char * EW)
-{
-    strtofloat(lat, this->lat);
-    this->lat.apply(degMin2DecDeg);
-    this->NS.setValue(*NS, *NS == 'N' || *NS == 'S');
-    strtofloat(lon, this->lon);
-    this->lon.apply(degMin2DecDeg);
-    this->EW.setValue(*EW, *EW == 'E' || *EW == 'W');
-}
-
-/* Returns the latitude (positive if north, negative if south) */
-Field<float_t> POS::getLatitude()
-{
-    Field<float_t> lat(this->lat);
+    Field<int32_t> lat(this->lat);
 
     if (lat.getValid() && this->NS.getValid())
     {
@@ -180,10 +338,10 @@ Field<float_t> POS::getLatitude()
     return lat;
 }
 
-/* Returns the longitude (positive if east, negative is west) */
-Field<float_t> POS::getLongitude()
+/* Returns the longitude in 1e-7 degrees (positive if east, negative is west) */
+Field<int32_t> POS::getLongitudeE7()
 {
-    Field<float_t> lon(this->lon);
+    Field<int32_t> lon(this->lon);
 
     if (lon.getValid() && this->EW.getValid())
     {
@@ -193,39 +351,105 @@ Field<float_t> POS::getLongitude()
     return lon;
 }
 
+/* Returns the latitude in decimal degrees (positive if north, negative if south) */
+Field<double_t> POS::getLatitude()
+{
+    Field<int32_t> latE7 = this->getLatitudeE7();
+    const int32_t * const lat = latE7.getValue();
+
+    return Field<double_t>(lat != NULL ? *lat / (double_t) COORDINATE_SCALE : 0, lat != NULL);
+}
+
+/* Returns the longitude in decimal degrees (positive if east, negative is west) */
+Field<double_t> POS::getLongitude()
+{
+    Field<int32_t> lonE7 = this->getLongitudeE7();
+    const int32_t * const lon = lonE7.getValue();
+
+    return Field<double_t>(lon != NULL ? *lon / (double_t) COORDINATE_SCALE : 0, lon != NULL);
+}
+
 POS * const POS::getPosition()
 {
     return (POS *) this;
 }
 
 /**
- * Returns the given longitude/latitude value in decimal degrees.
+ * Parses the given latitude/longitude field directly into fixed-point decimal degrees. Only integer
+ * arithmetic is used, so the full precision of the field is kept (up to 7 decimal places of minutes).
  * 
- * @param coords The longitude/latitude value in degrees, minutes and decimal minutes.
+ * @param coords The latitude/longitude field in degrees, minutes and decimal minutes.
  *               This must be of the format: (d)ddmm.mmmmm
  *               -> Where (d) is an optional term and can either be 0 or 1
- * 
- * @returns The given value converted to decimal degrees format.
- * 
- * @note This assumes that the input is between 180 and -180 degrees inclusive.
+ * @param field The field to set to the unsigned value in 1e-7 degrees. This is invalid if the format is
+ *              invalid or the value is out of range.
+ * @param maxDegrees The largest valid value in degrees (ie. 90 for latitude and 180 for longitude).
  */
-float_t POS::degMin2DecDeg(float_t coords)
+void POS::parseCoordinate(StrSpan coords, Field<int32_t>& field, uint8_t maxDegrees)
 {
-    float_t degrees = 0;
-    int8_t deg = 0;
-    float_t min = 0;
+    static const uint32_t FRACTION_SCALE[8] = {10000000, 1000000, 100000, 10000, 1000, 100, 10, 1};
+    uint32_t degrees = 0, minutes = 0, fraction = 0, total;
+    uint16_t i = 0, nFraction = 0;
+
+    field.setValue(0, false);
+
+    /* The degrees are every integer digit before the final two, which are the whole minutes */
+    while (i < coords.length && coords.str[i] != '.')
+    {
+        if (!isdigit((unsigned char) coords.str[i]) || i >= 5)
+            return;
+
+        degrees = degrees * 10 + (coords.str[i] - '0');
+        i++;
+    }
 
-    deg = (int32_t) coords / 100;
-    min = fabs(coords) - abs(deg * 100);
+    if (i < 3)
+        return;
 
-    // Calculate the total degrees (without sign so they can add nicely together)
-    degrees += abs(deg);
-    degrees += min / 60.0;
+    minutes = degrees % 100;
+    degrees /= 100;
+
+    /* Skip the decimal point, keeping up to 7 decimal places of the minutes */
+    for (i++; i < coords.length; i++)
+    {
+        if (!isdigit((unsigned char) coords.str[i]))
+            return;
+
+        if (nFraction < 7)
+        {
+            fraction = fraction * 10 + (coords.str[i] - '0');
+            nFraction++;
+        }
+    }
+
+    if (minutes >= 60 || degrees > maxDegrees)
+        return;
+
+    /* Minutes in 1e-7 minutes, then rounded to 1e-7 degrees */
+    minutes = minutes * COORDINATE_SCALE + fraction * FRACTION_SCALE[nFraction];
+    total = degrees * COORDINATE_SCALE + (minutes + 30) / 60;
+
+    if (total <= (uint32_t) maxDegrees * COORDINATE_SCALE)
+    {
+        field.setValue((int32_t) total, true);
+    }
+}
+
+/**
+ * Parses the given latitude/longitude offset (as given by `DTM`) into fixed-point decimal degrees.
+ * 
+ * @param offset The offset field in decimal minutes (eg. "0.08").
+ * @param field The field to set to the unsigned value in 1e-7 degrees. This is invalid if the field is
+ *              not a valid unsigned decimal number.
+ */
+void POS::parseCoordinateOffset(StrSpan offset, Field<int32_t>& field)
+{
+    double_t minutes = 0;
+    bool valid = offset.length > 0 && offset.str[0] != '-' && offset.str[0] != '+';
 
-    // Reapply sign to final degrees value
-    degrees *= deg < 0 ? -1 : 1;
+    valid = valid && parseDecimal(offset, minutes) && minutes <= 60;
 
-    return (float_t) degrees;
+    field.setValue(valid ? (int32_t) lround(minutes * COORDINATE_SCALE / 60) : 0, valid);
 }
 
 /* ------------------------- END POS Definitions ------------------------ */
@@ -248,16 +472,6 @@ Field<float_t> ALTITUDE::getAltitude()
     return this->alt;
 }
 
-bool ALTITUDE::checkValidity()
-{
-    return true;
-}
-
-void ALTITUDE::parseNMEA(char * alt)
-{
-    strtofloat(alt, this->alt);
-}
-
 /* ---------------------- END ALTITUDE Definitions ---------------------- */
 
 
@@ -278,22 +492,6 @@ POS3D * const POS3D::get3DPosition()
     return (POS3D *) this;
 }
 
-bool POS3D::checkValidity()
-{
-    bool valid = true;
-
-    valid &= POS::checkValidity();
-    valid &= ALTITUDE::checkValidity();
-
-    return valid;
-}
-
-void POS3D::parseNMEA(char * lat, char * NS, char * lon, char * EW, char * alt)
-{
-    POS::parseNMEA(lat, NS, lon, EW);
-    ALTITUDE::parseNMEA(alt);
-}
-
 /* ----------------------- END POS3D Definitions ------------------------ */
 
 
@@ -314,9 +512,11 @@ Field<std::string> TIME::getTime()
     return this->time;
 }
 
-bool TIME::checkTimeFormat(char * time)
+bool TIME::checkTimeFormat(StrSpan span)
 {
-    if (strlen(time) != 9)
+    const char * time = span.str;
+
+    if (span.length != 9)
     {
         return false;
     }
@@ -341,12 +541,12 @@ bool TIME::checkTimeFormat(char * time)
         return false;
     }
 
-    if (time[2] < '1' || time[2] > '5')
+    if (time[2] < '0' || time[2] > '5')
     {
         return false;
     }
 
-    if (time[4] < '1' || time[4] > '5')
+    if (time[4] < '0' || time[4] > '5')
     {
         return false;
     }
@@ -354,42 +554,11 @@ bool TIME::checkTimeFormat(char * time)
     return true;
 }
 
-void TIME::parseNMEA(char * time)
-{
-    this->time.setValue(std::string(time), this->checkTimeFormat(time));
-}   
-
 /* ------------------------ END TIME Definitions ------------------------ */
 
 
 /* -------------------------- DTM Definitions --------------------------- */
 
-DTM::DTM(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool DTM::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-    valid = valid && POS3D::checkValidity();
-
-    if (this->refDatum == "W84")
-        valid = false;
-    
-    return valid;
-}
-
-void DTM::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    POS3D::parseNMEA(lineArr[2], lineArr[3], lineArr[4], lineArr[5], lineArr[6]);
-
-    this->datum.setValue(std::string(lineArr[0]), true);
-    this->subDatum.setValue(std::string(lineArr[1]), true);
-    this->refDatum.setValue(std::string(lineArr[7]), true);
-}
-
 Field<std::string> DTM::getDatum()
 {
     return this->datum;
@@ -405,63 +574,29 @@ Field<std::string> DTM::getReferenceDatum()
     return this->refDatum;
 }
 
-void DTM::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 11;
-    *maxLength = 11;
-}
-
 /* ------------------------- END DTM Definitions ------------------------ */
 
 
 /* -------------------------- GBS Definitions --------------------------- */
 
-GBS::GBS(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool GBS::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-    
-    return valid;
-}
-
-void GBS::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    TIME::parseNMEA(lineArr[1]);
-
-    strtofloat(lineArr[2], this->errLat);
-    strtofloat(lineArr[3], this->errLon);
-    strtofloat(lineArr[4], this->errAlt);
-    strtouint8(lineArr[5], this->svid);
-    this->prob.setValue(255, false); /* Unsupported value (it is always fixed) */
-    strtofloat(lineArr[7], this->bias);
-    strtofloat(lineArr[8], this->stddev);
-    strtouint8(lineArr[9], this->systemId);
-    strtouint8(lineArr[10], this->signalId);
-}
-
 Field<float_t> GBS::getErrLat()
 {
-    return this->errLat;
+    return this->errLat.get();
 }
 
 Field<float_t> GBS::getErrLon()
 {
-    return this->errLon;
+    return this->errLon.get();
 }
 
 Field<float_t> GBS::getErrAlt()
 {
-    return this->errAlt;
+    return this->errAlt.get();
 }
 
 Field<uint8_t> GBS::getSVID()
 {
-    return this->svid;
+    return this->svid.get();
 }
 
 Field<uint8_t> GBS::getProb()
@@ -471,28 +606,22 @@ Field<uint8_t> GBS::getProb()
 
 Field<float_t> GBS::getBias()
 {
-    return this->bias;
+    return this->bias.get();
 }
 
 Field<float_t> GBS::getStdDeviation()
 {
-    return this->stddev;
+    return this->stddev.get();
 }
 
 Field<uint8_t> GBS::getSystemId()
 {
-    return this->systemId;
+    return this->systemId.get();
 }
 
 Field<uint8_t> GBS::getSignalId()
 {
-    return this->signalId;
-}
-
-void GBS::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 13;
-    *maxLength = 13;
+    return this->signalId.get();
 }
 
 /* ------------------------- END GBS Definitions ------------------------ */
@@ -500,44 +629,6 @@ void GBS::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
 
 /* -------------------------- GGA Definitions --------------------------- */
 
-GGA::GGA(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool GGA::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-    valid = valid && POS3D::checkValidity();
-    
-    if (this->quality == 0)
-        valid = false;
-
-    if (this->altUnit != 'M')   /* Fixed field (ie. metres) */
-        valid = false;
-
-    if (this->sepUnit != 'M')   /* Fixed field (ie. metres) */
-        valid = false;
-
-    return valid;
-}
-
-void GGA::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    TIME::parseNMEA(lineArr[1]);
-    POS3D::parseNMEA(lineArr[2], lineArr[3], lineArr[4], lineArr[5], lineArr[9]);
-
-    strtouint8(lineArr[6], this->quality);
-    strtouint8(lineArr[7], this->numSV);
-    strtofloat(lineArr[8], this->HDOP);
-    this->altUnit.setValue(*lineArr[10], *lineArr[10] == 'M');
-    strtofloat(lineArr[11], this->sep);
-    this->sepUnit.setValue(*lineArr[12], *lineArr[12] == 'M');
-    strtouint16(lineArr[13], this->diffAge);
-    strtouint16(lineArr[14], this->diffStation);
-}
-
 Field<uint8_t> GGA::getQuality()
 {
     return this->quality;
@@ -545,12 +636,12 @@ Field<uint8_t> GGA::getQuality()
 
 Field<uint8_t> GGA::getNumSatellites()
 {
-    return this->numSV;
+    return this->numSV.get();
 }
 
 Field<float_t> GGA::getHDOP()
 {
-    return this->HDOP;
+    return this->HDOP.get();
 }
 
 Field<char> GGA::getAltitudeUnit()
@@ -560,7 +651,7 @@ Field<char> GGA::getAltitudeUnit()
 
 Field<float_t> GGA::getGEOIDSep()
 {
-    return this->sep;
+    return this->sep.get();
 }
 
 Field<char> GGA::getGEOIDSepUnit()
@@ -570,18 +661,12 @@ Field<char> GGA::getGEOIDSepUnit()
 
 Field<uint16_t> GGA::getDiffAge()
 {
-    return this->diffAge;
+    return this->diffAge.get();
 }
 
 Field<uint16_t> GGA::getDiffStationID()
 {
-    return this->diffStation;
-}
-
-void GGA::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 17;
-    *maxLength = 17;
+    return this->diffStation.get();
 }
 
 /* ------------------------- END GGA Definitions ------------------------ */
@@ -589,32 +674,6 @@ void GGA::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
 
 /* -------------------------- GLL Definitions --------------------------- */
 
-GLL::GLL(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool GLL::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-    valid = valid && POS::checkValidity();
-
-    if (this->status != 'A')
-        valid = false;
-    
-    return valid;
-}
-
-void GLL::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    POS::parseNMEA(lineArr[1], lineArr[2], lineArr[3], lineArr[4]);
-    TIME::parseNMEA(lineArr[5]);
-
-    this->status.setValue(*lineArr[6], true);
-    this->posMode.setValue(*lineArr[7], true);
-}
-
 Field<char> GLL::getStatus()
 {
     return this->status;
@@ -625,48 +684,11 @@ Field<char> GLL::getPosMode()
     return this->posMode;
 }
 
-void GLL::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 10;
-    *maxLength = 10;
-}
-
 /* ------------------------- END GLL Definitions ------------------------ */
 
 
 /* -------------------------- GNS Definitions --------------------------- */
 
-GNS::GNS(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool GNS::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-    valid = valid && POS3D::checkValidity();
-    
-    if (this->navStatus != 'V') /* Fixed field as hardware is not providing nav status info */
-        valid = false;
-
-    return valid;
-}
-
-void GNS::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    TIME::parseNMEA(lineArr[1]);
-    POS3D::parseNMEA(lineArr[2], lineArr[3], lineArr[4], lineArr[5], lineArr[9]);
-
-    this->posMode.setValue(std::string(lineArr[6]), true);
-    strtouint8(lineArr[7], this->numSV);
-    strtofloat(lineArr[8], this->HDOP);
-    strtofloat(lineArr[10], this->sep);
-    strtouint16(lineArr[11], this->diffAge);
-    strtouint16(lineArr[12], this->diffStation);
-    this->navStatus.setValue(*lineArr[13], true);
-}
-
 Field<std::string> GNS::getPosMode()
 {
     return this->posMode;
@@ -674,27 +696,27 @@ Field<std::string> GNS::getPosMode()
 
 Field<uint8_t> GNS::getNumSV()
 {
-    return this->numSV;
+    return this->numSV.get();
 }
 
 Field<float_t> GNS::getHDOP()
 {
-    return this->HDOP;
+    return this->HDOP.get();
 }
 
 Field<float_t> GNS::getGEOIDSep()
 {
-    return this->sep;
+    return this->sep.get();
 }
 
 Field<uint16_t> GNS::getDiffAge()
 {
-    return this->diffAge;
+    return this->diffAge.get();
 }
 
 Field<uint16_t> GNS::getDiffStationID()
 {
-    return this->diffStation;
+    return this->diffStation.get();
 }
 
 Field<char> GNS::getNavStatus()
@@ -702,47 +724,11 @@ Field<char> GNS::getNavStatus()
     return this->navStatus;
 }
 
-void GNS::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 16;
-    *maxLength = 16;
-}
-
 /* ------------------------- END GNS Definitions ------------------------ */
 
 
 /* -------------------------- GRS Definitions --------------------------- */
 
-GRS::GRS(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool GRS::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    return valid;
-}
-
-void GRS::parseNMEA(char ** lineArr, uint16_t length)
-{
-    uint8_t i;
-
-    BASE::parseNMEA(lineArr, length);
-    TIME::parseNMEA(lineArr[1]);
-
-    strtouint8(lineArr[2], this->mode);
-    
-    for (i = 0; i < 12; i++)
-    {
-        strtofloat(lineArr[3 + i], this->residual[i]);
-    }
-
-    strtouint8(lineArr[15], this->systemId);
-    strtouint8(lineArr[16], this->signalId);
-}
-
 Field<uint8_t> GRS::getComputationMethod()
 {
     return this->mode;
@@ -755,18 +741,12 @@ const Field<float_t> * const GRS::getResiduals()
 
 Field<uint8_t> GRS::getSystemId()
 {
-    return this->systemId;
+    return this->systemId.get();
 }
 
 Field<uint8_t> GRS::getSingalId()
 {
-    return this->signalId;
-}
-
-void GRS::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 19;
-    *maxLength = 19;
+    return this->signalId.get();
 }
 
 /* ------------------------- END GRS Definitions ------------------------ */
@@ -774,41 +754,6 @@ void GRS::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
 
 /* -------------------------- GSA Definitions --------------------------- */
 
-GSA::GSA(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool GSA::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    if (this->navMode == 1) /* There was no fix for this sentence */
-        valid = false;
-
-    return valid;
-}
-
-void GSA::parseNMEA(char ** lineArr, uint16_t length)
-{
-    uint8_t i;
-
-    BASE::parseNMEA(lineArr, length);
-
-    this->opMode.setValue(*lineArr[1], true);
-    strtouint8(lineArr[2], this->navMode);
-
-    for (i = 0; i < 12; i++)
-    {
-        strtouint8(lineArr[3 + i], this->svid[i]);
-    }
-
-    strtofloat(lineArr[15], this->PDOP);
-    strtofloat(lineArr[16], this->HDOP);
-    strtofloat(lineArr[17], this->VDOP);
-    strtouint8(lineArr[18], this->systemId);
-}
-
 Field<char> GSA::getOpMode()
 {
     return this->opMode;
@@ -826,28 +771,22 @@ const Field<uint8_t> * const GSA::getSVID()
 
 Field<float_t> GSA::getPDOP()
 {
-    return this->PDOP;
+    return this->PDOP.get();
 }
 
 Field<float_t> GSA::getHDOP()
 {
-    return this->HDOP;
+    return this->HDOP.get();
 }
 
 Field<float_t> GSA::getVDOP()
 {
-    return this->VDOP;
+    return this->VDOP.get();
 }
 
 Field<uint8_t> GSA::getSystemId()
 {
-    return this->systemId;
-}
-
-void GSA::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 21;
-    *maxLength = 21;
+    return this->systemId.get();
 }
 
 /* ------------------------- END GSA Definitions ------------------------ */
@@ -855,71 +794,39 @@ void GSA::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
 
 /* -------------------------- GST Definitions --------------------------- */
 
-GST::GST(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool GST::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    return valid;
-}
-
-void GST::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    TIME::parseNMEA(lineArr[1]);
-
-    strtofloat(lineArr[2], this->rangeRms);
-    strtofloat(lineArr[3], this->stdMajor);
-    strtofloat(lineArr[4], this->stdMinor);
-    strtofloat(lineArr[5], this->orient);
-    strtofloat(lineArr[6], this->stdLat);
-    strtofloat(lineArr[7], this->stdLong);
-    strtofloat(lineArr[8], this->stdAlt);
-}
-
 Field<float_t> GST::getRangeRMS()
 {
-    return this->rangeRms;
+    return this->rangeRms.get();
 }
 
 Field<float_t> GST::getStdMajor()
 {
-    return this->stdMajor;
+    return this->stdMajor.get();
 }
 
 Field<float_t> GST::getStdMinor()
 {
-    return this->stdMinor;
+    return this->stdMinor.get();
 }
 
 Field<float_t> GST::getOrientation()
 {
-    return this->orient;
+    return this->orient.get();
 }
 
 Field<float_t> GST::getStdLatitude()
 {
-    return this->stdLat;
+    return this->stdLat.get();
 }
 
 Field<float_t> GST::getStdLongitude()
 {
-    return this->stdLong;
+    return this->stdLong.get();
 }
 
 Field<float_t> GST::getStdAltitude()
 {
-    return this->stdAlt;
-}
-
-void GST::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 11;
-    *maxLength = 11;
+    return this->stdAlt.get();
 }
 
 /* ------------------------- END GST Definitions ------------------------ */
@@ -927,72 +834,19 @@ void GST::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
 
 /* -------------------------- GSV Definitions --------------------------- */
 
-GSV::GSV(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool GSV::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    return valid;
-}
-
-void GSV::parseNMEA(char ** lineArr, uint16_t length)
-{
-    uint8_t i, nGroups;
-
-    BASE::parseNMEA(lineArr, length);
-
-    strtouint8(lineArr[1], this->numMsg);
-    strtouint8(lineArr[2], this->msgNum);
-    strtouint8(lineArr[3], this->numSV);
-
-    /* Number of repeated groups = (total length - fixed length) / fields in group */
-    nGroups = (length - 6) / 4;
-
-    this->satellites = new Field<SatData>[nGroups];
-    this->satellitesLength = nGroups;
-
-    SatData tempData;
-
-    for (i = 0; i < nGroups; i++)
-    {
-        bool valid = true;
-        char * endPtr;
-
-        tempData.svid = strtoul(lineArr[4 + 4*i], &endPtr, 10);
-        valid &= *endPtr == '\0';   // Ensure that the entire integer was consumed
-
-        tempData.elv = strtoul(lineArr[5 + 4*i], &endPtr, 10);
-        valid &= *endPtr == '\0';   // Ensure that the entire integer was consumed
-
-        tempData.az = strtoul(lineArr[6 + 4*i], &endPtr, 10);
-        valid &= *endPtr == '\0';   // Ensure that the entire integer was consumed
-
-        tempData.cno = strtoul(lineArr[7 + 4*i], &endPtr, 10);
-        valid &= *endPtr == '\0';   // Ensure that the entire integer was consumed
-
-        this->satellites[0].setValue(tempData, valid);
-    }
-
-    strtouint8(lineArr[4 + 4*nGroups], this->signalId);
-}
-
 Field<uint8_t> GSV::getNumMessages()
 {
-    return this->numMsg;
+    return this->numMsg.get();
 }
 
 Field<uint8_t> GSV::getMessageNum()
 {
-    return this->msgNum;
+    return this->msgNum.get();
 }
 
 Field<uint8_t> GSV::getNumSatellites()
 {
-    return this->numSV;
+    return this->numSV.get();
 }
 
 const Field<SatData> * const GSV::getSatellites(uint8_t * const arrLength)
@@ -1007,20 +861,7 @@ const Field<SatData> * const GSV::getSatellites(uint8_t * const arrLength)
 
 Field<uint8_t> GSV::getSignalId()
 {
-    return this->signalId;
-}
-
-void GSV::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 11;
-    *maxLength = 23;
-}
-
-GSV::~GSV()
-{
-    BASE::~BASE();
-
-    delete this->satellites;
+    return this->signalId.get();
 }
 
 /* ------------------------- END GSV Definitions ------------------------ */
@@ -1028,28 +869,6 @@ GSV::~GSV()
 
 /* -------------------------- RLM Definitions --------------------------- */
 
-RLM::RLM(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool RLM::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    return valid;
-}
-
-void RLM::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    TIME::parseNMEA(lineArr[2]);
-
-    strtouint64(lineArr[1], this->beacon, 16);
-    this->code.setValue(*lineArr[3], true);
-    strtouint64(lineArr[1], this->beacon, 16);
-}
-
 Field<uint64_t> RLM::getBeacon()
 {
     return this->beacon;
@@ -1065,55 +884,11 @@ Field<uint64_t> RLM::getBody()
     return this->body;
 }
 
-void RLM::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 7;
-    *maxLength = 7;
-}
-
 /* ------------------------- END RLM Definitions ------------------------ */
 
 
 /* -------------------------- RMC Definitions --------------------------- */
 
-RMC::RMC(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool RMC::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-    valid = valid && POS::checkValidity();
-
-    if (this->status != 'A')
-        valid = false;
-    
-    if (this->posMode == 'N')
-        valid = false;
-
-    if (this->navStatus != 'V') /* Fixed field so should always be V */
-        valid = false;
-
-    return valid;
-}
-
-void RMC::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    TIME::parseNMEA(lineArr[1]);
-    POS::parseNMEA(lineArr[3], lineArr[4], lineArr[5], lineArr[6]);
-
-    this->status.setValue(*lineArr[2], true);
-    strtofloat(lineArr[7], this->spd);
-    strtofloat(lineArr[8], this->cog);
-    this->date.setValue(std::string(lineArr[9]), true);
-    strtofloat(lineArr[10], this->mv);
-    this->mvEW.setValue(*lineArr[11], *lineArr[11] == 'E' || *lineArr[11] == 'W');
-    this->posMode.setValue(*lineArr[12], true);
-    this->navStatus.setValue(*lineArr[13], true);
-}
-
 Field<char> RMC::getStatus()
 {
     return this->status;
@@ -1121,12 +896,12 @@ Field<char> RMC::getStatus()
 
 Field<float_t> RMC::getSpeedOverGround()
 {
-    return this->spd;
+    return this->spd.get();
 }
 
 Field<float_t> RMC::getCourseOverGround()
 {
-    return this->cog;
+    return this->cog.get();
 }
 
 Field<std::string> RMC::getDate()
@@ -1136,7 +911,7 @@ Field<std::string> RMC::getDate()
 
 Field<float_t> RMC::getMagneticVariation()
 {
-    return this->mv;
+    return this->mv.get();
 }
 
 Field<char> RMC::getMagneticVariationDir()
@@ -1154,52 +929,24 @@ Field<char> RMC::getNavStatus()
     return this->navStatus;
 }
 
-void RMC::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 16;
-    *maxLength = 16;
-}
-
 /* ------------------------- END RMC Definitions ------------------------ */
 
 
 /* -------------------------- TXT Definitions --------------------------- */
 
-TXT::TXT(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool TXT::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    return valid;
-}
-
-void TXT::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-
-    strtouint8(lineArr[1], this->numMsg);
-    strtouint8(lineArr[2], this->msgNum);
-    strtouint8(lineArr[3], this->msgType);
-    this->text.setValue(std::string(lineArr[4]), true);
-}
-
 Field<uint8_t> TXT::getNumMessages()
 {
-    return this->numMsg;
+    return this->numMsg.get();
 }
 
 Field<uint8_t> TXT::getMessageNum()
 {
-    return this->msgNum;
+    return this->msgNum.get();
 }
 
 Field<uint8_t> TXT::getMessageType()
 {
-    return this->msgType;
+    return this->msgType.get();
 }
 
 Field<std::string> TXT::getText()
@@ -1207,55 +954,11 @@ Field<std::string> TXT::getText()
     return this->text;
 }
 
-void TXT::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 7;
-    *maxLength = 7;
-}
-
 /* ------------------------- END TXT Definitions ------------------------ */
 
 
 /* -------------------------- VLW Definitions --------------------------- */
 
-VLW::VLW(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool VLW::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    if (this->twdUnit != 'N')
-        valid = false;
-
-    if (this->wdUnit != 'N')
-        valid = false;
-
-    if (this->tgdUnit != 'N')
-        valid = false;
-
-    if (this->gdUnit != 'N')
-        valid = false;
-
-    return valid;
-}
-
-void VLW::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-
-    this->twd.setValue(255, false); /* Fixed field: null */
-    this->twdUnit.setValue(*lineArr[2], *lineArr[2] == 'N'); /* Fixed field: N */
-    this->wd.setValue(255, false); /* Fixed field: null */
-    this->wdUnit.setValue(*lineArr[4], *lineArr[4] == 'N'); /* Fixed field: N */
-    strtofloat(lineArr[5], this->tgd);
-    this->tgdUnit.setValue(*lineArr[6], *lineArr[6] == 'N'); /* Fixed field: N */
-    strtofloat(lineArr[7], this->gd);
-    this->gdUnit.setValue(*lineArr[8], *lineArr[8] == 'N'); /* Fixed field: N */
-}
-
 Field<uint8_t> VLW::getTotalWaterDist()
 {
     return this->twd;
@@ -1278,7 +981,7 @@ Field<char> VLW::getWDUnit()
 
 Field<float_t> VLW::getTotalGroundDist()
 {
-    return this->tgd;
+    return this->tgd.get();
 }
 
 Field<char> VLW::getTGDUnit()
@@ -1288,7 +991,7 @@ Field<char> VLW::getTGDUnit()
 
 Field<float_t> VLW::getGroundDist()
 {
-    return this->gd;
+    return this->gd.get();
 }
 
 Field<char> VLW::getGDUnit()
@@ -1296,62 +999,14 @@ Field<char> VLW::getGDUnit()
     return this->gdUnit;
 }
 
-void VLW::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 11;
-    *maxLength = 11;
-}
-
 /* ------------------------- END VLW Definitions ------------------------ */
 
 
 /* -------------------------- VTG Definitions --------------------------- */
 
-VTG::VTG(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool VTG::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    if (this->posMode == 'N')
-        valid = false;
-
-    if (this->cogtUnit != 'T')
-        valid = false;
-
-    if (this->cogmUnit != 'M')
-        valid = false;
-
-    if (this->sognUnit != 'N')
-        valid = false;
-
-    if (this->sogkUnit != 'K')
-        valid = false;
-
-    return valid;
-}
-
-void VTG::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-
-    strtofloat(lineArr[1], this->cogt);
-    this->cogtUnit.setValue(*lineArr[2], *lineArr[2] == 'T');
-    strtofloat(lineArr[3], this->cogm);
-    this->cogmUnit.setValue(*lineArr[4], *lineArr[4] == 'M');
-    strtofloat(lineArr[5], this->sogn);
-    this->sognUnit.setValue(*lineArr[6], *lineArr[6] == 'N');
-    strtofloat(lineArr[7], this->sogk);
-    this->sogkUnit.setValue(*lineArr[8], *lineArr[8] == 'K');
-    this->posMode.setValue(*lineArr[9], true);
-}
-
 Field<float_t> VTG::getTrueCourseOverGround()
 {
-    return this->cogt;
+    return this->cogt.get();
 }
 
 Field<char> VTG::getTCOGUnit()
@@ -1361,7 +1016,7 @@ Field<char> VTG::getTCOGUnit()
 
 Field<float_t> VTG::getMagneticCourseOverGround()
 {
-    return this->cogm;
+    return this->cogm.get();
 }
 
 Field<char> VTG::getMCOGUnit()
@@ -1371,7 +1026,7 @@ Field<char> VTG::getMCOGUnit()
 
 Field<float_t> VTG::getSpeedOverGroundKnots()
 {
-    return this->sogn;
+    return this->sogn.get();
 }
 
 Field<char> VTG::getSOGNUnit()
@@ -1381,7 +1036,7 @@ Field<char> VTG::getSOGNUnit()
 
 Field<float_t> VTG::getSpeedOverGroundKms()
 {
-    return this->sogk;
+    return this->sogk.get();
 }
 
 Field<char> VTG::getSOGKUnit()
@@ -1394,53 +1049,11 @@ Field<char> VTG::getPosMode()
     return this->posMode;
 }
 
-void VTG::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 12;
-    *maxLength = 12;
-}
-
 /* ------------------------- END VTG Definitions ------------------------ */
 
 
 /* -------------------------- ZDA Definitions --------------------------- */
 
-ZDA::ZDA(char ** lineArr, uint16_t length) : BASE(lineArr, length)
-{
-
-}
-
-bool ZDA::checkValidity()
-{
-    bool valid = BASE::checkValidity();
-
-    if (this->day < 1 || this->day > 31)
-        valid = false;
-
-    if (this->month < 1 || this-> month > 12)
-        valid = false;
-
-    if (this->ltzh != 0)
-        valid = false;
-
-    if (this->ltzn != 0)
-        valid = false;
-
-    return valid;
-}
-
-void ZDA::parseNMEA(char ** lineArr, uint16_t length)
-{
-    BASE::parseNMEA(lineArr, length);
-    TIME::parseNMEA(lineArr[1]);
-
-    strtouint8(lineArr[2], this->day);
-    strtouint8(lineArr[3], this->month);
-    strtouint16(lineArr[4], this->year);
-    strtouint8(lineArr[5], this->ltzh);
-    strtouint8(lineArr[6], this->ltzn);
-}
-
 Field<uint8_t> ZDA::getDay()
 {
     return this->day;
@@ -1453,7 +1066,7 @@ Field<uint8_t> ZDA::getMonth()
 
 Field<uint16_t> ZDA::getYear()
 {
-    return this->year;
+    return this->year.get();
 }
 
 Field<uint8_t> ZDA::getLocalTimezoneHrs()
@@ -1466,10 +1079,4 @@ Field<uint8_t> ZDA::getLocalTimezoneMins()
     return this->ltzn;
 }
 
-void ZDA::getSentenceBounds(uint8_t * minLength, uint8_t * maxLength)
-{
-    *minLength = 9;
-    *maxLength = 9;
-}
-
 /* ------------------------- END ZDA Definitions ------------------------ */
\ No newline at end of file
@@ -2,7 +2,7 @@
  * FILE: sentences.hpp
  * PURPOSE: The header file to declare all of the sentence structures for NMEA communication.
  * 
- * UPDATED: 13 Nov. 2025
+ * UPDATED: 17 Oct. 2026
  * 
  * NOTE: The NMEA sentences were implemented based on the definitions found in the interface description
  *       for the u-blox NeoM9N GNSS module. A link to this interface description can be found below.
@@ -13,11 +13,11 @@
 #ifndef INC_SENTENCES_HPP_
 #define INC_SENTENCES_HPP_
 
-#include <regex>
 #include <string>
 #include <vector>
 #include <ctime>
 #include <compare>
+#include <variant>
 
 #include <stdint.h>
 #include <math.h>
@@ -28,6 +28,20 @@
 #include "gnss.h"
 #include "data_validation.hpp"
 
+/* The maximum number of fields (including the header) that a sentence can be split into */
+#define NMEA_MAX_FIELDS 24
+
+/* The number of fixed-point coordinate units in a degree (ie. coordinates are in 1e-7 degrees) */
+#define COORDINATE_SCALE 10000000
+
+/* Set to 1 to decode optional fields when they are first read, or 0 to decode them when parsed */
+#ifndef NMEA_LAZY_DECODING
+#define NMEA_LAZY_DECODING 1
+#endif
+
+/* The maximum number of satellites that can be given in a single GSV sentence */
+#define GSV_MAX_SATELLITES 4
+
 extern "C"
 {
     /**
@@ -44,37 +58,324 @@ extern "C"
     } SatData;
 }
 
+/* A set of sentence types, where bit n is set if the `Sentences` value n is in the set */
+typedef uint32_t SentenceMask;
+
 /**
- * The template class to create and retrieve NMEA sentences from a given string. If the sentence in the
- * given string is of the same class as the provided template class then the sentence created is valid.
- * If the provided string is not the same as the provided template class, then the sentence is invalid
- * and the internal sentence value is `NULL`.
+ * The compile-time classification of NMEA headers. The talker ID and sentence formatter of a header are
+ * each packed into a single integer and mapped to their respective enums in constant time, without any
+ * string comparisons.
  */
-template <typename T> class Sentence
+namespace NMEA_ID
 {
-    public:
-    Sentence(char * line);
-    T * const getSentence();
+    /* The sentence formatters, in the same order as the `Sentences` enum (offset by `NMEA_DTM`) */
+    constexpr uint8_t N_FORMATTERS = 20;
+    constexpr char FORMATTERS[N_FORMATTERS][4] = {
+        "DTM", "GAQ", "GBQ", "GBS", "GGA", "GLL", "GLQ", "GNQ", "GNS", "GPQ",
+        "GRS", "GSA", "GST", "GSV", "RLM", "RMC", "TXT", "VLW", "VTG", "ZDA"
+    };
 
-    private:
-    T * sentence = NULL;
+    /**
+     * Packs the given characters into a single integer, with the first character in the most
+     * significant position.
+     */
+    constexpr uint32_t pack(const char * chars, uint8_t nChars)
+    {
+        uint32_t packed = 0;
 
-    inline void assertCorrectType();
-    bool isAcceptedSubtype(char * header);
-    
-    /* -------------- Static Functions -------------- */
-    private:
-    static int8_t verifyFormat(const char * data);
-    static T * getFromHeader(const char * const header, char ** lineArr, uint16_t length);
+        for (uint8_t i = 0; i < nChars; i++)
+        {
+            packed = packed << 8 | (uint8_t) chars[i];
+        }
 
-    public:
-    static int8_t nmeaChecksum(const char * data);
-    /* ------------ End Static Functions ------------ */
+        return packed;
+    }
+
+    /* Returns the mask containing only the given sentence type */
+    constexpr SentenceMask bit(Sentences type)
+    {
+        return (SentenceMask) 1 << type;
+    }
+
+    /* Returns the mask containing all of the given sentence types */
+    template <typename... Types>
+    constexpr SentenceMask mask(Types... types)
+    {
+        return (bit(types) | ... | 0);
+    }
+
+    /* The mask of every valid sentence type (ie. every type other than NMEA_INV) */
+    constexpr SentenceMask ALL = (bit(NMEA_ZDA) << 1) - bit(NMEA_DTM);
+
+    /**
+     * The sentence formatters are mapped to their types using a perfect hash - a multiplicative hash that
+     * was chosen so that no two formatters share a slot in the table. This means that only one
+     * comparison is needed to classify a formatter.
+     */
+    constexpr uint32_t HASH_MULTIPLIER = 0xE1AE57C7;
+    constexpr uint8_t HASH_BITS = 5;
+
+    constexpr uint8_t hash(uint32_t packed)
+    {
+        return (uint32_t) (packed * HASH_MULTIPLIER) >> (32 - HASH_BITS);
+    }
+
+    struct HashSlot
+    {
+        uint32_t packed;
+        Sentences type;
+    };
+
+    struct HashTable
+    {
+        HashSlot slots[1 << HASH_BITS];
+    };
+
+    constexpr HashTable buildTable()
+    {
+        HashTable table = {};
+
+        for (uint8_t i = 0; i < N_FORMATTERS; i++)
+        {
+            uint32_t packed = pack(FORMATTERS[i], 3);
+
+            table.slots[hash(packed)] = {packed, (Sentences) (NMEA_DTM + i)};
+        }
+
+        return table;
+    }
+
+    constexpr HashTable TABLE = buildTable();
+
+    constexpr bool isPerfect()
+    {
+        for (uint8_t i = 0; i < N_FORMATTERS; i++)
+        {
+            if (TABLE.slots[hash(pack(FORMATTERS[i], 3))].type != (Sentences) (NMEA_DTM + i))
+            {
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    static_assert(isPerfect(), "HASH_MULTIPLIER must map every sentence formatter to a unique slot");
+
+    /**
+     * Converts the given header to the type of sentence that it contains.
+     * 
+     * @param header The header in the format: $TTSSS
+     * 
+     * @returns The sentence type from the header or `NMEA_INV` if it is not a known type.
+     */
+    constexpr Sentences getType(const char * header)
+    {
+        uint32_t packed = pack(header + 3, 3);
+        const HashSlot& slot = TABLE.slots[hash(packed)];
+
+        return slot.packed == packed ? slot.type : NMEA_INV;
+    }
 
+    /**
+     * Converts the given header to the constellation of its talker ID.
+     * 
+     * @param header The header in the format: $TTSSS
+     * 
+     * @returns The constellation from the header or `INVALID` if it cannot be determined.
+     */
+    constexpr Constellation getConstellation(const char * header)
+    {
+        switch (pack(header + 1, 2))
+        {
+            case pack("GP", 2): return GPS;
+            case pack("GL", 2): return GLONASS;
+            case pack("GA", 2): return GALILEO;
+            case pack("GB", 2): return BEIDOU;
+            case pack("BD", 2): return BEIDOU;
+            case pack("GN", 2): return NONE;
+            default: return INVALID;
+        }
+    }
+};
+
+/**
+ * An NMEA sentence that has been verified and split into its fields by `scanNMEA`. The fields point
+ * into the scanned string, so the string must outlive the `NMEALine`.
+ */
+struct NMEALine
+{
+    StrSpan fields[NMEA_MAX_FIELDS];    // The header and data fields, not including the checksum
+    uint16_t length;                    // The number of fields in the sentence
+    uint8_t checksum;                   // The checksum given at the end of the sentence
+};
+
+int8_t scanNMEA(const char * data, size_t maxLength, NMEALine * const line);
+
+/**
+ * A `Field` that is decoded from its NMEA field the first time it is read, rather than when the sentence
+ * is parsed. Once decoded, the value is cached, so the field is decoded at most once.
+ * 
+ * This is used for fields that are not needed to validate a sentence, as most consumers only read a
+ * few fields from each sentence.
+ * 
+ * @note With `NMEA_LAZY_DECODING` enabled, the field refers to the line that it was parsed from, so the
+ *       line must remain valid for as long as the field may be read.
+ */
+template <typename T> class LazyField
+{
     public:
-    ~Sentence();
+    void setSource(StrSpan source, uint8_t base = 10);
+    Field<T> get();
+
+    private:
+    Field<T> field;
+    StrSpan source = {NULL, 0};
+    uint8_t base = 10;
+    bool pending = false;
+
+    void decode();
 };
 
+/**
+ * The compile-time schemas of the NMEA sentences. Each sentence class declares a `Schema` listing the
+ * number of fields it may have and, for each field, its index, its type and any fixed value that the
+ * field must have. The parser and validity checks for the sentence are then generated from the schema,
+ * so each sentence is parsed with straight-line code and without any virtual calls.
+ * 
+ * For example:
+```
+using Schema = NMEA_SCHEMA::Schema<15, 15,
+    NMEA_SCHEMA::Time<&GGA::time, 1>,
+    NMEA_SCHEMA::Number<&GGA::quality, 6, NMEA_SCHEMA::Excluded<0>>,
+    NMEA_SCHEMA::Char<&GGA::altUnit, 10, NMEA_SCHEMA::Required<'M'>>,
+    ...
+>;
+```
+ * 
+ * @note A field index is the index of the field in `NMEALine::fields`, where 0 is the header. A negative
+ *       index counts back from the last field (ie. -1 is the last field).
+ */
+namespace NMEA_SCHEMA
+{
+    /* ---------------- Field checks ---------------- */
+
+    /* Any value is accepted */
+    struct Any
+    {
+        static constexpr bool REQUIRED = false;
+        template <typename T> static constexpr bool accepts(const T&) { return true; }
+    };
+
+    /* The field is only valid if it is one of the given values, but the sentence is valid either way */
+    template <auto... values> struct OneOf
+    {
+        static constexpr bool REQUIRED = false;
+        template <typename T> static constexpr bool accepts(const T& value) { return ((value == values) || ...); }
+    };
+
+    /* The sentence is only valid if the field is one of the given values */
+    template <auto... values> struct Required
+    {
+        static constexpr bool REQUIRED = true;
+        template <typename T> static constexpr bool accepts(const T& value) { return ((value == values) || ...); }
+    };
+
+    /* The sentence is only valid if the field is valid and is not any of the given values */
+    template <auto... values> struct Excluded
+    {
+        static constexpr bool REQUIRED = true;
+        template <typename T> static constexpr bool accepts(const T& value) { return ((value != values) && ...); }
+    };
+
+    /* The sentence is only valid if the field is between the given values (inclusive) */
+    template <auto min, auto max> struct Range
+    {
+        static constexpr bool REQUIRED = true;
+        template <typename T> static constexpr bool accepts(const T& value) { return value >= min && value <= max; }
+    };
+
+    /* -------------- End Field checks -------------- */
+
+    /* ---------------- Field kinds ----------------- */
+
+    /* A numeric field, stored in either a `Field` or a `LazyField` */
+    template <auto member, int8_t index, typename Check = Any, uint8_t base = 10> struct Number
+    {
+        static constexpr int8_t INDEX = index;
+        template <typename S> static bool parse(S& sentence, const StrSpan * fields, uint16_t length);
+    };
+
+    /* A single character field */
+    template <auto member, int8_t index, typename Check = Any> struct Char
+    {
+        static constexpr int8_t INDEX = index;
+        template <typename S> static bool parse(S& sentence, const StrSpan * fields, uint16_t length);
+    };
+
+    /* A string field */
+    template <auto member, int8_t index> struct Text
+    {
+        static constexpr int8_t INDEX = index;
+        template <typename S> static bool parse(S& sentence, const StrSpan * fields, uint16_t length);
+    };
+
+    /* A time field, which is only valid if it is of the format "HHMMSS.SS" (see `TIME`) */
+    template <auto member, int8_t index> struct Time
+    {
+        static constexpr int8_t INDEX = index;
+        template <typename S> static bool parse(S& sentence, const StrSpan * fields, uint16_t length);
+    };
+
+    /* A latitude/longitude field of the format (d)ddmm.mmmmm (see `POS::parseCoordinate`) */
+    template <auto member, int8_t index, uint8_t maxDegrees> struct Coordinate
+    {
+        static constexpr int8_t INDEX = index;
+        template <typename S> static bool parse(S& sentence, const StrSpan * fields, uint16_t length);
+    };
+
+    /* A latitude/longitude offset in minutes (see `POS::parseCoordinateOffset`) */
+    template <auto member, int8_t index> struct CoordinateOffset
+    {
+        static constexpr int8_t INDEX = index;
+        template <typename S> static bool parse(S& sentence, const StrSpan * fields, uint16_t length);
+    };
+
+    /* A fixed number of consecutive numeric fields, stored in an array of `Field`s */
+    template <auto member, int8_t first, uint8_t count> struct Array
+    {
+        static constexpr int8_t INDEX = first + count - 1;
+        template <typename S> static bool parse(S& sentence, const StrSpan * fields, uint16_t length);
+    };
+
+    /* A variable number of repeated satellite groups (svid, elv, az, cno), followed by `nTrailing` fields */
+    template <auto member, auto count, int8_t first, uint8_t nTrailing> struct Satellites
+    {
+        static constexpr int8_t INDEX = first - 1;
+        template <typename S> static bool parse(S& sentence, const StrSpan * fields, uint16_t length);
+    };
+
+    /* -------------- End Field kinds --------------- */
+
+    /**
+     * The schema of a sentence with between `minFields` and `maxFields` fields (including the header),
+     * made up of the given fields.
+     */
+    template <uint8_t minFields, uint8_t maxFields, typename... Fields> struct Schema
+    {
+        static_assert(minFields <= maxFields && maxFields <= NMEA_MAX_FIELDS, "Ensure the field bounds are valid");
+        static_assert(
+            ((Fields::INDEX >= 0 ? Fields::INDEX < minFields : -Fields::INDEX <= minFields) && ...),
+            "Ensure that every field is within the minimum number of fields"
+        );
+
+        static constexpr uint8_t MIN_FIELDS = minFields;
+        static constexpr uint8_t MAX_FIELDS = maxFields;
+
+        template <typename S> static bool parse(S& sentence, const NMEALine * const line);
+    };
+}
+
 /**
  * The base data class for all sentences. This contains the header, the constellation and the checksum
  * of the sentence. All of the valid NMEA sentences contain this info.
@@ -82,22 +383,14 @@ template <typename T> class Sentence
 class BASE
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    BASE(char ** lineArr, uint16_t length);
-    virtual bool initialise(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::ALL;
+    bool initialise(const NMEALine * const line);
     Constellation getConstellation();
 
     protected:
     std::string header;
     Constellation constellation = INVALID;
     uint8_t checksum = 0;
-    bool verifyBounds(uint16_t nFields);
-    virtual bool checkValidity();
-    virtual void parseNMEA(char ** lineArr, uint16_t length);
-    virtual void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength);
-
-    public:
-    virtual ~BASE();
 };
 
 /**
@@ -123,16 +416,17 @@ class STD_MSG_POLL : public GROUP
     STD_MSG_POLL();
 
     public:
-    static const std::vector<std::string> acceptedTypes;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GAQ, NMEA_GBQ, NMEA_GLQ, NMEA_GNQ, NMEA_GPQ);
+    Field<std::string> getMessageId();
 
-    private:
-    char * msgId;
+    protected:
+    Field<std::string> msgId;
 };
 
 /**
- * A group that contains position data (not including altitude). The longitude and latitude is 
- * stored in degrees and minutes and are converted to decimal degrees when retrieving the latitude
- * and longitude values using the appropriate getters.
+ * A group that contains position data (not including altitude). The latitude and longitude are parsed
+ * directly from degrees and minutes into fixed-point integers (in units of 1e-7 degrees), so none of
+ * the precision given by the receiver is lost. Floating point values are only derived when requested.
  */
 class POS : public GROUP
 {
@@ -143,21 +437,21 @@ class POS : public GROUP
     POS();
 
     public:
-    static const std::vector<std::string> acceptedTypes;
-    Field<float_t> getLatitude();
-    Field<float_t> getLongitude();
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_DTM, NMEA_GGA, NMEA_GLL, NMEA_GNS, NMEA_RMC);
+    Field<int32_t> getLatitudeE7();
+    Field<int32_t> getLongitudeE7();
+    Field<double_t> getLatitude();
+    Field<double_t> getLongitude();
     POS * const getPosition();
 
-    static float_t degMin2DecDeg(float_t coords);
+    static void parseCoordinate(StrSpan coords, Field<int32_t>& field, uint8_t maxDegrees);
+    static void parseCoordinateOffset(StrSpan offset, Field<int32_t>& field);
 
     protected:
-    Field<float_t> lat;
+    Field<int32_t> lat;     // Unsigned, in 1e-7 degrees
     Field<char> NS;
-    Field<float_t> lon;
+    Field<int32_t> lon;     // Unsigned, in 1e-7 degrees
     Field<char> EW;
-    
-    bool checkValidity();
-    void parseNMEA(char * lat, char * NS, char * lon, char * EW);
 };
 
 /**
@@ -172,20 +466,16 @@ class ALTITUDE : public GROUP
     ALTITUDE();
 
     public:
-    static const std::vector<std::string> acceptedTypes;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_DTM, NMEA_GGA, NMEA_GNS);
     Field<float_t> getAltitude();
 
     protected:
     Field<float_t> alt;
-
-    bool checkValidity();
-    void parseNMEA(char * alt);
 };
 
 /**
  * A group that contains longitude, latitude and altitude information. Similar to the `POS` group, the
- * longitude and latitude values are stored as degrees and minutes and only converted to decimal
- * degrees when queried using the appropriate getters.
+ * longitude and latitude values are stored as fixed-point decimal degrees.
  */
 class POS3D : public POS, public ALTITUDE
 {
@@ -196,12 +486,8 @@ class POS3D : public POS, public ALTITUDE
     POS3D();
 
     public:
-    static const std::vector<std::string> acceptedTypes;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_DTM, NMEA_GGA, NMEA_GNS);
     POS3D * const get3DPosition();
-
-    protected:
-    bool checkValidity();
-    void parseNMEA(char * lat, char * NS, char * lon, char * EW, char * alt);
 };
 
 /**
@@ -220,14 +506,13 @@ class TIME : public GROUP
     TIME();
 
     public:
-    static const std::vector<std::string> acceptedTypes;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GBS, NMEA_GGA, NMEA_GLL, NMEA_GNS, NMEA_GRS, NMEA_GST, NMEA_RLM, NMEA_RMC, NMEA_ZDA);
     Field<std::string> getTime();
 
+    static bool checkTimeFormat(StrSpan span);
+
     protected:
     Field<std::string> time{"000000.00"};
-
-    bool checkTimeFormat(char * time);
-    void parseNMEA(char * time);
 };
 
 /**
@@ -236,8 +521,7 @@ class TIME : public GROUP
 class DTM : public BASE, public POS3D
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    DTM(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_DTM);
 
     Field<std::string> getDatum();
     Field<std::string> getSubDatum();
@@ -248,38 +532,46 @@ class DTM : public BASE, public POS3D
     Field<std::string> subDatum;
     Field<std::string> refDatum;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--DTM,datum,subDatum,lat,NS,lon,EW,alt,refDatum*hh */
+    using Schema = NMEA_SCHEMA::Schema<9, 9,
+        NMEA_SCHEMA::Text<&DTM::datum, 1>,
+        NMEA_SCHEMA::Text<&DTM::subDatum, 2>,
+        NMEA_SCHEMA::CoordinateOffset<&DTM::lat, 3>,
+        NMEA_SCHEMA::Char<&DTM::NS, 4, NMEA_SCHEMA::Required<'N', 'S'>>,
+        NMEA_SCHEMA::CoordinateOffset<&DTM::lon, 5>,
+        NMEA_SCHEMA::Char<&DTM::EW, 6, NMEA_SCHEMA::Required<'E', 'W'>>,
+        NMEA_SCHEMA::Number<&DTM::alt, 7>,
+        NMEA_SCHEMA::Text<&DTM::refDatum, 8>
+    >;
 };
 
 /**
  * The class for polling a standard message (Talker ID: GA)
- * 
- * @note Currently not implemented as it is not required.
  */
 class GAQ : public BASE, public STD_MSG_POLL
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    
-    protected:
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GAQ);
+
+    /* $--GAQ,msgId*hh */
+    using Schema = NMEA_SCHEMA::Schema<2, 2,
+        NMEA_SCHEMA::Text<&GAQ::msgId, 1>
+    >;
 };
 
 /**
  * The class for polling a standard message (Talker ID: GB)
- * 
- * @note Currently not implemented as it is not required.
  */
 class GBQ : public BASE, public STD_MSG_POLL
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    
-    protected:
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GBQ);
+
+    /* $--GBQ,msgId*hh */
+    using Schema = NMEA_SCHEMA::Schema<2, 2,
+        NMEA_SCHEMA::Text<&GBQ::msgId, 1>
+    >;
 };
 
 /**
@@ -288,8 +580,7 @@ class GBQ : public BASE, public STD_MSG_POLL
 class GBS : public BASE, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    GBS(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GBS);
     Field<float_t> getErrLat();
     Field<float_t> getErrLon();
     Field<float_t> getErrAlt();
@@ -302,20 +593,29 @@ class GBS : public BASE, public TIME
 
 
     private:
-    Field<float_t> errLat;
-    Field<float_t> errLon;
-    Field<float_t> errAlt;
-    Field<uint8_t> svid;
+    LazyField<float_t> errLat;
+    LazyField<float_t> errLon;
+    LazyField<float_t> errAlt;
+    LazyField<uint8_t> svid;
     Field<uint8_t> prob;   /* Unsupported */
-    Field<float_t> bias;
-    Field<float_t> stddev;
-    Field<uint8_t> systemId;
-    Field<uint8_t> signalId;
+    LazyField<float_t> bias;
+    LazyField<float_t> stddev;
+    LazyField<uint8_t> systemId;
+    LazyField<uint8_t> signalId;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--GBS,time,errLat,errLon,errAlt,svid,prob,bias,stddev,systemId,signalId*hh */
+    using Schema = NMEA_SCHEMA::Schema<11, 11,
+        NMEA_SCHEMA::Time<&GBS::time, 1>,
+        NMEA_SCHEMA::Number<&GBS::errLat, 2>,
+        NMEA_SCHEMA::Number<&GBS::errLon, 3>,
+        NMEA_SCHEMA::Number<&GBS::errAlt, 4>,
+        NMEA_SCHEMA::Number<&GBS::svid, 5>,
+        NMEA_SCHEMA::Number<&GBS::bias, 7>,
+        NMEA_SCHEMA::Number<&GBS::stddev, 8>,
+        NMEA_SCHEMA::Number<&GBS::systemId, 9>,
+        NMEA_SCHEMA::Number<&GBS::signalId, 10>
+    >;
 };
 
 /**
@@ -324,8 +624,7 @@ class GBS : public BASE, public TIME
 class GGA : public BASE, public POS3D, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    GGA(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GGA);
     Field<uint8_t> getQuality();
     Field<uint8_t> getNumSatellites();
     Field<float_t> getHDOP();
@@ -337,18 +636,32 @@ class GGA : public BASE, public POS3D, public TIME
     
     private:
     Field<uint8_t> quality;
-    Field<uint8_t> numSV;
-    Field<float_t> HDOP;
+    LazyField<uint8_t> numSV;
+    LazyField<float_t> HDOP;
     Field<char> altUnit;
-    Field<float_t> sep;
+    LazyField<float_t> sep;
     Field<char> sepUnit;
-    Field<uint16_t> diffAge;
-    Field<uint16_t> diffStation;
+    LazyField<uint16_t> diffAge;
+    LazyField<uint16_t> diffStation;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--GGA,time,lat,NS,lon,EW,quality,numSV,HDOP,alt,altUnit,sep,sepUnit,diffAge,diffStation*hh */
+    using Schema = NMEA_SCHEMA::Schema<15, 15,
+        NMEA_SCHEMA::Time<&GGA::time, 1>,
+        NMEA_SCHEMA::Coordinate<&GGA::lat, 2, 90>,
+        NMEA_SCHEMA::Char<&GGA::NS, 3, NMEA_SCHEMA::Required<'N', 'S'>>,
+        NMEA_SCHEMA::Coordinate<&GGA::lon, 4, 180>,
+        NMEA_SCHEMA::Char<&GGA::EW, 5, NMEA_SCHEMA::Required<'E', 'W'>>,
+        NMEA_SCHEMA::Number<&GGA::quality, 6, NMEA_SCHEMA::Excluded<0>>,
+        NMEA_SCHEMA::Number<&GGA::numSV, 7>,
+        NMEA_SCHEMA::Number<&GGA::HDOP, 8>,
+        NMEA_SCHEMA::Number<&GGA::alt, 9>,
+        NMEA_SCHEMA::Char<&GGA::altUnit, 10, NMEA_SCHEMA::Required<'M'>>,
+        NMEA_SCHEMA::Number<&GGA::sep, 11>,
+        NMEA_SCHEMA::Char<&GGA::sepUnit, 12, NMEA_SCHEMA::Required<'M'>>,
+        NMEA_SCHEMA::Number<&GGA::diffAge, 13>,
+        NMEA_SCHEMA::Number<&GGA::diffStation, 14>
+    >;
 };
 
 /**
@@ -357,8 +670,7 @@ class GGA : public BASE, public POS3D, public TIME
 class GLL : public BASE, public POS, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    GLL(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GLL);
     Field<char> getStatus();
     Field<char> getPosMode();
 
@@ -366,38 +678,45 @@ class GLL : public BASE, public POS, public TIME
     Field<char> status;
     Field<char> posMode;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--GLL,lat,NS,lon,EW,time,status,posMode*hh */
+    using Schema = NMEA_SCHEMA::Schema<8, 8,
+        NMEA_SCHEMA::Coordinate<&GLL::lat, 1, 90>,
+        NMEA_SCHEMA::Char<&GLL::NS, 2, NMEA_SCHEMA::Required<'N', 'S'>>,
+        NMEA_SCHEMA::Coordinate<&GLL::lon, 3, 180>,
+        NMEA_SCHEMA::Char<&GLL::EW, 4, NMEA_SCHEMA::Required<'E', 'W'>>,
+        NMEA_SCHEMA::Time<&GLL::time, 5>,
+        NMEA_SCHEMA::Char<&GLL::status, 6, NMEA_SCHEMA::Required<'A'>>,
+        NMEA_SCHEMA::Char<&GLL::posMode, 7>
+    >;
 };
 
 /**
  * The class for polling a standard message (Talker ID: GL)
- * 
- * @note Currently not implemented as it is not required
  */
 class GLQ : public BASE, public STD_MSG_POLL
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    
-    protected:
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GLQ);
+
+    /* $--GLQ,msgId*hh */
+    using Schema = NMEA_SCHEMA::Schema<2, 2,
+        NMEA_SCHEMA::Text<&GLQ::msgId, 1>
+    >;
 };
 
 /**
  * The class for polling a standard message (Talker ID: GN)
- * 
- * @note Currently not implemented as it is not required
  */
 class GNQ : public BASE, public STD_MSG_POLL
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    
-    protected:
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GNQ);
+
+    /* $--GNQ,msgId*hh */
+    using Schema = NMEA_SCHEMA::Schema<2, 2,
+        NMEA_SCHEMA::Text<&GNQ::msgId, 1>
+    >;
 };
 
 /**
@@ -406,8 +725,7 @@ class GNQ : public BASE, public STD_MSG_POLL
 class GNS : public BASE, public POS3D, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    GNS(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GNS);
     Field<std::string> getPosMode();
     Field<uint8_t> getNumSV();
     Field<float_t> getHDOP();
@@ -418,31 +736,44 @@ class GNS : public BASE, public POS3D, public TIME
 
     private:
     Field<std::string> posMode;
-    Field<uint8_t> numSV;
-    Field<float_t> HDOP;
-    Field<float_t> sep;
-    Field<uint16_t> diffAge;
-    Field<uint16_t> diffStation;
+    LazyField<uint8_t> numSV;
+    LazyField<float_t> HDOP;
+    LazyField<float_t> sep;
+    LazyField<uint16_t> diffAge;
+    LazyField<uint16_t> diffStation;
     Field<char> navStatus;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--GNS,time,lat,NS,lon,EW,posMode,numSV,HDOP,alt,sep,diffAge,diffStation,navStatus*hh */
+    using Schema = NMEA_SCHEMA::Schema<14, 14,
+        NMEA_SCHEMA::Time<&GNS::time, 1>,
+        NMEA_SCHEMA::Coordinate<&GNS::lat, 2, 90>,
+        NMEA_SCHEMA::Char<&GNS::NS, 3, NMEA_SCHEMA::Required<'N', 'S'>>,
+        NMEA_SCHEMA::Coordinate<&GNS::lon, 4, 180>,
+        NMEA_SCHEMA::Char<&GNS::EW, 5, NMEA_SCHEMA::Required<'E', 'W'>>,
+        NMEA_SCHEMA::Text<&GNS::posMode, 6>,
+        NMEA_SCHEMA::Number<&GNS::numSV, 7>,
+        NMEA_SCHEMA::Number<&GNS::HDOP, 8>,
+        NMEA_SCHEMA::Number<&GNS::alt, 9>,
+        NMEA_SCHEMA::Number<&GNS::sep, 10>,
+        NMEA_SCHEMA::Number<&GNS::diffAge, 11>,
+        NMEA_SCHEMA::Number<&GNS::diffStation, 12>,
+        NMEA_SCHEMA::Char<&GNS::navStatus, 13, NMEA_SCHEMA::Required<'V'>>
+    >;
 };
 
 /**
  * The class for polling a standard message (Talker ID: GP)
- * 
- * @note Currently not implemented as it is not required
  */
 class GPQ : public BASE, public STD_MSG_POLL
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    
-    protected:
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GPQ);
+
+    /* $--GPQ,msgId*hh */
+    using Schema = NMEA_SCHEMA::Schema<2, 2,
+        NMEA_SCHEMA::Text<&GPQ::msgId, 1>
+    >;
 };
 
 /**
@@ -451,8 +782,7 @@ class GPQ : public BASE, public STD_MSG_POLL
 class GRS : public BASE, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    GRS(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GRS);
     Field<uint8_t> getComputationMethod();
     const Field<float_t> * const getResiduals();
     Field<uint8_t> getSystemId();
@@ -461,13 +791,18 @@ class GRS : public BASE, public TIME
     private:
     Field<uint8_t> mode;
     Field<float_t> residual[12];
-    Field<uint8_t> systemId;
-    Field<uint8_t> signalId;
+    LazyField<uint8_t> systemId;
+    LazyField<uint8_t> signalId;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--GRS,time,mode,residual x 12,systemId,signalId*hh */
+    using Schema = NMEA_SCHEMA::Schema<17, 17,
+        NMEA_SCHEMA::Time<&GRS::time, 1>,
+        NMEA_SCHEMA::Number<&GRS::mode, 2>,
+        NMEA_SCHEMA::Array<&GRS::residual, 3, 12>,
+        NMEA_SCHEMA::Number<&GRS::systemId, 15>,
+        NMEA_SCHEMA::Number<&GRS::signalId, 16>
+    >;
 };
 
 /**
@@ -476,8 +811,7 @@ class GRS : public BASE, public TIME
 class GSA : public BASE
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    GSA(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GSA);
     Field<char> getOpMode();
     Field<uint8_t> getNavMode();
     const Field<uint8_t> * const getSVID();
@@ -490,15 +824,22 @@ class GSA : public BASE
     Field<char> opMode;
     Field<uint8_t> navMode;
     Field<uint8_t> svid[12];
-    Field<float_t> PDOP;    // Position Dilution of Precision
-    Field<float_t> HDOP;    // Horizontal Dilution of Precision
-    Field<float_t> VDOP;    // Vertical Dilution of Precision
-    Field<uint8_t> systemId;
+    LazyField<float_t> PDOP;    // Position Dilution of Precision
+    LazyField<float_t> HDOP;    // Horizontal Dilution of Precision
+    LazyField<float_t> VDOP;    // Vertical Dilution of Precision
+    LazyField<uint8_t> systemId;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--GSA,opMode,navMode,svid x 12,PDOP,HDOP,VDOP,systemId*hh */
+    using Schema = NMEA_SCHEMA::Schema<19, 19,
+        NMEA_SCHEMA::Char<&GSA::opMode, 1>,
+        NMEA_SCHEMA::Number<&GSA::navMode, 2, NMEA_SCHEMA::Excluded<1>>,
+        NMEA_SCHEMA::Array<&GSA::svid, 3, 12>,
+        NMEA_SCHEMA::Number<&GSA::PDOP, 15>,
+        NMEA_SCHEMA::Number<&GSA::HDOP, 16>,
+        NMEA_SCHEMA::Number<&GSA::VDOP, 17>,
+        NMEA_SCHEMA::Number<&GSA::systemId, 18>
+    >;
 };
 
 /**
@@ -507,8 +848,7 @@ class GSA : public BASE
 class GST : public BASE, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    GST(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GST);
     Field<float_t> getRangeRMS();
     Field<float_t> getStdMajor();
     Field<float_t> getStdMinor();
@@ -518,18 +858,26 @@ class GST : public BASE, public TIME
     Field<float_t> getStdAltitude();
 
     private:
-    Field<float_t> rangeRms;
-    Field<float_t> stdMajor;
-    Field<float_t> stdMinor;
-    Field<float_t> orient;
-    Field<float_t> stdLat;
-    Field<float_t> stdLong;
-    Field<float_t> stdAlt;
+    LazyField<float_t> rangeRms;
+    LazyField<float_t> stdMajor;
+    LazyField<float_t> stdMinor;
+    LazyField<float_t> orient;
+    LazyField<float_t> stdLat;
+    LazyField<float_t> stdLong;
+    LazyField<float_t> stdAlt;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--GST,time,rangeRms,stdMajor,stdMinor,orient,stdLat,stdLong,stdAlt*hh */
+    using Schema = NMEA_SCHEMA::Schema<9, 9,
+        NMEA_SCHEMA::Time<&GST::time, 1>,
+        NMEA_SCHEMA::Number<&GST::rangeRms, 2>,
+        NMEA_SCHEMA::Number<&GST::stdMajor, 3>,
+        NMEA_SCHEMA::Number<&GST::stdMinor, 4>,
+        NMEA_SCHEMA::Number<&GST::orient, 5>,
+        NMEA_SCHEMA::Number<&GST::stdLat, 6>,
+        NMEA_SCHEMA::Number<&GST::stdLong, 7>,
+        NMEA_SCHEMA::Number<&GST::stdAlt, 8>
+    >;
 };
 
 /**
@@ -538,8 +886,7 @@ class GST : public BASE, public TIME
 class GSV : public BASE
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    GSV(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_GSV);
     Field<uint8_t> getNumMessages();
     Field<uint8_t> getMessageNum();
     Field<uint8_t> getNumSatellites();
@@ -547,20 +894,22 @@ class GSV : public BASE
     Field<uint8_t> getSignalId();
 
     private:
-    Field<uint8_t> numMsg;
-    Field<uint8_t> msgNum;
-    Field<uint8_t> numSV;
-    Field<SatData> * satellites = NULL; /* Note: can appear up to 4 times, not always 4. */
+    LazyField<uint8_t> numMsg;
+    LazyField<uint8_t> msgNum;
+    LazyField<uint8_t> numSV;
+    Field<SatData> satellites[GSV_MAX_SATELLITES]; /* Note: can appear up to 4 times, not always 4. */
     uint8_t satellitesLength = 0;
-    Field<uint8_t> signalId;
-
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override; 
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    LazyField<uint8_t> signalId;
 
     public:
-    ~GSV() override;
+    /* $--GSV,numMsg,msgNum,numSV,{svid,elv,az,cno} x 0-4,signalId*hh */
+    using Schema = NMEA_SCHEMA::Schema<5, 21,
+        NMEA_SCHEMA::Number<&GSV::numMsg, 1>,
+        NMEA_SCHEMA::Number<&GSV::msgNum, 2>,
+        NMEA_SCHEMA::Number<&GSV::numSV, 3>,
+        NMEA_SCHEMA::Satellites<&GSV::satellites, &GSV::satellitesLength, 4, 1>,
+        NMEA_SCHEMA::Number<&GSV::signalId, -1>
+    >;
 };
 
 /**
@@ -569,8 +918,7 @@ class GSV : public BASE
 class RLM : public BASE, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    RLM(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_RLM);
     Field<uint64_t> getBeacon();
     Field<char> getCode();
     Field<uint64_t> getBody();
@@ -580,10 +928,14 @@ class RLM : public BASE, public TIME
     Field<char> code;
     Field<uint64_t> body; /* This assumes that the value cannot exceed 64bit - this may need to be verified */
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--RLM,beacon,time,code,body*hh */
+    using Schema = NMEA_SCHEMA::Schema<5, 5,
+        NMEA_SCHEMA::Number<&RLM::beacon, 1, NMEA_SCHEMA::Any, 16>,
+        NMEA_SCHEMA::Time<&RLM::time, 2>,
+        NMEA_SCHEMA::Char<&RLM::code, 3>,
+        NMEA_SCHEMA::Number<&RLM::body, 4, NMEA_SCHEMA::Any, 16>
+    >;
 };
 
 /**
@@ -592,8 +944,7 @@ class RLM : public BASE, public TIME
 class RMC : public BASE, public POS, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    RMC(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_RMC);
     Field<char> getStatus();
     Field<float_t> getSpeedOverGround();
     Field<float_t> getCourseOverGround();
@@ -605,18 +956,31 @@ class RMC : public BASE, public POS, public TIME
 
     private:
     Field<char> status;
-    Field<float_t> spd;
-    Field<float_t> cog;
+    LazyField<float_t> spd;
+    LazyField<float_t> cog;
     Field<std::string> date;
-    Field<float_t> mv;
+    LazyField<float_t> mv;
     Field<char> mvEW;
     Field<char> posMode;
     Field<char> navStatus;
 
-   protected:
-   bool checkValidity() override;
-   void parseNMEA(char ** lineArr, uint16_t length) override;
-   void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--RMC,time,status,lat,NS,lon,EW,spd,cog,date,mv,mvEW,posMode,navStatus*hh */
+    using Schema = NMEA_SCHEMA::Schema<14, 14,
+        NMEA_SCHEMA::Time<&RMC::time, 1>,
+        NMEA_SCHEMA::Char<&RMC::status, 2, NMEA_SCHEMA::Required<'A'>>,
+        NMEA_SCHEMA::Coordinate<&RMC::lat, 3, 90>,
+        NMEA_SCHEMA::Char<&RMC::NS, 4, NMEA_SCHEMA::Required<'N', 'S'>>,
+        NMEA_SCHEMA::Coordinate<&RMC::lon, 5, 180>,
+        NMEA_SCHEMA::Char<&RMC::EW, 6, NMEA_SCHEMA::Required<'E', 'W'>>,
+        NMEA_SCHEMA::Number<&RMC::spd, 7>,
+        NMEA_SCHEMA::Number<&RMC::cog, 8>,
+        NMEA_SCHEMA::Text<&RMC::date, 9>,
+        NMEA_SCHEMA::Number<&RMC::mv, 10>,
+        NMEA_SCHEMA::Char<&RMC::mvEW, 11, NMEA_SCHEMA::OneOf<'E', 'W'>>,
+        NMEA_SCHEMA::Char<&RMC::posMode, 12, NMEA_SCHEMA::Excluded<'N'>>,
+        NMEA_SCHEMA::Char<&RMC::navStatus, 13, NMEA_SCHEMA::Required<'V'>>
+    >;
 };
 
 /**
@@ -625,23 +989,26 @@ class RMC : public BASE, public POS, public TIME
 class TXT : public BASE
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    TXT(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_TXT);
     Field<uint8_t> getNumMessages();
     Field<uint8_t> getMessageNum();
     Field<uint8_t> getMessageType();
     Field<std::string> getText();
 
     private:
-    Field<uint8_t> numMsg;
-    Field<uint8_t> msgNum;
-    Field<uint8_t> msgType;
+    LazyField<uint8_t> numMsg;
+    LazyField<uint8_t> msgNum;
+    LazyField<uint8_t> msgType;
     Field<std::string> text;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--TXT,numMsg,msgNum,msgType,text*hh */
+    using Schema = NMEA_SCHEMA::Schema<5, 5,
+        NMEA_SCHEMA::Number<&TXT::numMsg, 1>,
+        NMEA_SCHEMA::Number<&TXT::msgNum, 2>,
+        NMEA_SCHEMA::Number<&TXT::msgType, 3>,
+        NMEA_SCHEMA::Text<&TXT::text, 4>
+    >;
 };
 
 /**
@@ -650,8 +1017,7 @@ class TXT : public BASE
 class VLW : public BASE
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    VLW(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_VLW);
     Field<uint8_t> getTotalWaterDist(); /* Fixed field: null */
     Field<char> getTWDUnit();
     Field<uint8_t> getWaterDist(); /* Fixed field: null */
@@ -666,15 +1032,21 @@ class VLW : public BASE
     Field<char> twdUnit;
     Field<uint8_t> wd; /* Fixed field: null */
     Field<char> wdUnit;
-    Field<float_t> tgd;
+    LazyField<float_t> tgd;
     Field<char> tgdUnit;
-    Field<float_t> gd;
+    LazyField<float_t> gd;
     Field<char> gdUnit;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--VLW,twd,twdUnit,wd,wdUnit,tgd,tgdUnit,gd,gdUnit*hh */
+    using Schema = NMEA_SCHEMA::Schema<9, 9,
+        NMEA_SCHEMA::Char<&VLW::twdUnit, 2, NMEA_SCHEMA::Required<'N'>>,
+        NMEA_SCHEMA::Char<&VLW::wdUnit, 4, NMEA_SCHEMA::Required<'N'>>,
+        NMEA_SCHEMA::Number<&VLW::tgd, 5>,
+        NMEA_SCHEMA::Char<&VLW::tgdUnit, 6, NMEA_SCHEMA::Required<'N'>>,
+        NMEA_SCHEMA::Number<&VLW::gd, 7>,
+        NMEA_SCHEMA::Char<&VLW::gdUnit, 8, NMEA_SCHEMA::Required<'N'>>
+    >;
 };
 
 /**
@@ -683,8 +1055,7 @@ class VLW : public BASE
 class VTG : public BASE
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    VTG(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_VTG);
     Field<float_t> getTrueCourseOverGround();
     Field<char> getTCOGUnit();
     Field<float_t> getMagneticCourseOverGround();
@@ -696,20 +1067,29 @@ class VTG : public BASE
     Field<char> getPosMode();
 
     private:
-    Field<float_t> cogt;
+    LazyField<float_t> cogt;
     Field<char> cogtUnit; /* Fixed field: T */
-    Field<float_t> cogm;
+    LazyField<float_t> cogm;
     Field<char> cogmUnit; /* Fixed field: M */
-    Field<float_t> sogn;
+    LazyField<float_t> sogn;
     Field<char> sognUnit; /* Fixed field: N */
-    Field<float_t> sogk;
+    LazyField<float_t> sogk;
     Field<char> sogkUnit; /* Fixed field: K */
     Field<char> posMode;
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--VTG,cogt,cogtUnit,cogm,cogmUnit,sogn,sognUnit,sogk,sogkUnit,posMode*hh */
+    using Schema = NMEA_SCHEMA::Schema<10, 10,
+        NMEA_SCHEMA::Number<&VTG::cogt, 1>,
+        NMEA_SCHEMA::Char<&VTG::cogtUnit, 2, NMEA_SCHEMA::Required<'T'>>,
+        NMEA_SCHEMA::Number<&VTG::cogm, 3>,
+        NMEA_SCHEMA::Char<&VTG::cogmUnit, 4, NMEA_SCHEMA::Required<'M'>>,
+        NMEA_SCHEMA::Number<&VTG::sogn, 5>,
+        NMEA_SCHEMA::Char<&VTG::sognUnit, 6, NMEA_SCHEMA::Required<'N'>>,
+        NMEA_SCHEMA::Number<&VTG::sogk, 7>,
+        NMEA_SCHEMA::Char<&VTG::sogkUnit, 8, NMEA_SCHEMA::Required<'K'>>,
+        NMEA_SCHEMA::Char<&VTG::posMode, 9, NMEA_SCHEMA::Excluded<'N'>>
+    >;
 };
 
 /**
@@ -718,8 +1098,7 @@ class VTG : public BASE
 class ZDA : public BASE, public TIME
 {
     public:
-    static const std::vector<std::string> acceptedTypes;
-    ZDA(char ** lineArr, uint16_t length);
+    static constexpr SentenceMask acceptedTypes = NMEA_ID::mask(NMEA_ZDA);
     Field<uint8_t> getDay();
     Field<uint8_t> getMonth();
     Field<uint16_t> getYear();
@@ -729,14 +1108,89 @@ class ZDA : public BASE, public TIME
     private:
     Field<uint8_t> day;
     Field<uint8_t> month;
-    Field<uint16_t> year;
+    LazyField<uint16_t> year;
     Field<uint8_t> ltzh; /* Fixed field: 00 */
     Field<uint8_t> ltzn; /* Fixed field: 00 */
 
-    protected:
-    bool checkValidity() override;
-    void parseNMEA(char ** lineArr, uint16_t length) override;
-    void getSentenceBounds(uint8_t * minLength, uint8_t * maxLength) override;
+    public:
+    /* $--ZDA,time,day,month,year,ltzh,ltzn*hh */
+    using Schema = NMEA_SCHEMA::Schema<7, 7,
+        NMEA_SCHEMA::Time<&ZDA::time, 1>,
+        NMEA_SCHEMA::Number<&ZDA::day, 2, NMEA_SCHEMA::Range<1, 31>>,
+        NMEA_SCHEMA::Number<&ZDA::month, 3, NMEA_SCHEMA::Range<1, 12>>,
+        NMEA_SCHEMA::Number<&ZDA::year, 4>,
+        NMEA_SCHEMA::Number<&ZDA::ltzh, 5, NMEA_SCHEMA::Required<0>>,
+        NMEA_SCHEMA::Number<&ZDA::ltzn, 6, NMEA_SCHEMA::Required<0>>
+    >;
+};
+
+/**
+ * The in-place storage for a parsed sentence. This is large enough to hold any of the supported sentence
+ * types, so no sentence needs to be allocated on the heap.
+ */
+typedef std::variant<
+    std::monostate,
+    DTM, GAQ, GBQ, GBS, GGA, GLL, GLQ, GNQ, GNS, GPQ, GRS, GSA, GST, GSV, RLM, RMC, TXT, VLW, VTG, ZDA
+> SentenceStorage;
+
+/**
+ * A sentence that is verified, classified and parsed exactly once from a given string. Unlike `Sentence`,
+ * the type of the sentence does not need to be known when it is created. The parsed sentence can then be
+ * viewed as any of the `BASE` or `GROUP` types that it belongs to using `as`, without parsing it again.
+ * 
+ * For example:
+ * If the given NMEA sentence is: $GNGGA,...
+ * Then `as<GGA>()`, `as<POS>()`, `as<POS3D>()`, `as<ALTITUDE>()` and `as<TIME>()` all return a view of
+ * the same parsed `GGA` sentence, whereas `as<RMC>()` returns `NULL`.
+ * 
+ * @note The sentence is held in place within this object, so creating a `ParsedSentence` does not
+ *       allocate any memory.
+ * @note The optional fields of the sentence are decoded when first read (see `LazyField`), so the line
+ *       must remain valid for as long as the sentence is used.
+ */
+class ParsedSentence
+{
+    public:
+    ParsedSentence(const char * line, size_t maxLength = SIZE_MAX, SentenceMask accepted = NMEA_ID::ALL);
+    ParsedSentence(const NMEALine * const line, SentenceMask accepted = NMEA_ID::ALL);
+    ParsedSentence(const ParsedSentence&) = delete;
+    ParsedSentence& operator=(const ParsedSentence&) = delete;
+
+    Sentences getType();
+    BASE * const getSentence();
+    template <typename T> T * const as();
+
+    private:
+    Sentences type = NMEA_INV;
+    BASE * sentence = NULL;
+    SentenceStorage storage;
+
+    void parse(const NMEALine * const line, SentenceMask accepted);
+    BASE * createSentence(Sentences type, const NMEALine * const line);
+    template <typename S> BASE * emplace(const NMEALine * const line);
+    template <typename T, typename S> T * const project();
+};
+
+/**
+ * The template class to create and retrieve NMEA sentences from a given string. If the sentence in the
+ * given string is of the same class as the provided template class then the sentence created is valid.
+ * If the provided string is not the same as the provided template class, then the sentence is invalid
+ * and the internal sentence value is `NULL`.
+ * 
+ * @note The sentence is held in place (see `ParsedSentence`), so a `GROUP` sentence is a view of the
+ *       parsed sentence rather than a copy of it.
+ */
+template <typename T> class Sentence
+{
+    public:
+    Sentence(char * line);
+    T * const getSentence();
+
+    private:
+    ParsedSentence parsed;
+    T * sentence = NULL;
+
+    inline void assertCorrectType();
 };
 
 /* Include the template implementation after declaration
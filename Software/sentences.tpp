@@ -2,12 +2,62 @@
  * FILE: sentences.tpp
  * PURPOSE: To serve as the template implementation file for all of the sentences
  * 
- * UPDATED: 14 Nov. 2025
+ * UPDATED: 17 Oct. 2026
  * 
  * NOTE: Do NOT include this file other than at the end of sentences.hpp.
  *       Any other includes may lead to issues.
  */
 
+/* ----------------------- LazyField Definitions ------------------------ */
+
+/**
+ * Sets the NMEA field from which the value is decoded. Only the location of the field is recorded,
+ * unless `NMEA_LAZY_DECODING` is disabled, in which case the field is decoded immediately.
+ * 
+ * @param source The NMEA field, not including the delimiters.
+ * @param base The base that the field is written in.
+ */
+template <typename T>
+void LazyField<T>::setSource(StrSpan source, uint8_t base)
+{
+    this->source = source;
+    this->base = base;
+    this->pending = true;
+
+#if !NMEA_LAZY_DECODING
+    this->decode();
+#endif
+}
+
+/**
+ * Returns the decoded field, decoding and validating it first if it has not been read before.
+ * 
+ * @returns The decoded field. If the NMEA field is empty or not a valid value, the field is invalid.
+ */
+template <typename T>
+Field<T> LazyField<T>::get()
+{
+    if (this->pending)
+    {
+        this->decode();
+    }
+
+    return this->field;
+}
+
+/**
+ * Decodes the source into the cached field using the span parser for the type `T`.
+ */
+template <typename T>
+void LazyField<T>::decode()
+{
+    strtonumber(this->source, this->field, this->base);
+
+    this->pending = false;
+}
+
+/* --------------------- End LazyField Definitions ---------------------- */
+
 /* ------------------------ Sentence Definitions ------------------------ */
 
 /**
@@ -17,73 +67,21 @@
  * as the given type (`T`) for the `Sentence` template, then the sentence is created and can be found
  * as `sentence`, otherwise if it is not then the `sentence` field is `NULL`.
  * 
+ * For example:
+ * If the given NMEA sentence is: $GNGLL,1234.56789,S,12345.67891,E,123456.78,A,D*66
+ * And the sentence object is of the type: Sentence<POS>
+ * Then `sentence` is the `POS` part of the parsed `GLL` sentence.
+ * 
  * @param line The string from which to interpret the sentence.
+ * 
+ * @note Sentences that are not accepted by `T` are only classified, not parsed.
  */
 template <typename T>
-Sentence<T>::Sentence(char * line)
+Sentence<T>::Sentence(char * line) : parsed(line, SIZE_MAX, T::acceptedTypes)
 {
     this->assertCorrectType();
 
-    int8_t validFormat = -1;
-    char ** lineArr = NULL;
-    uint16_t length = 0;
-    char delim[] = ",";
-
-    /* Use REGEX matching to identify if the sentence is the correct format for an NMEA sentence */
-    validFormat = Sentence::verifyFormat(line);
-
-    /* Ensure that the format of the sentence is valid */
-    if (validFormat == 0)
-    {
-        /* Ensure that the sentence has a correct checksum */
-        if (Sentence::nmeaChecksum(line) == 0)
-        {
-            /* Split the sentence into its constituent parts and create an object from it */
-            lineArr = splitString(line, delim, &length);
-            
-            /* If the sentence is the correct type, create it, otherwise set it to NULL */
-            if(this->isAcceptedSubtype(lineArr[0]))
-            {
-                bool initialised = false;
-
-                /* If the given type is a GROUP type, then use a group retrieving method to get the
-                sentence value */
-                if constexpr (std::is_base_of_v<GROUP, T> && !std::is_base_of_v<BASE, T>)
-                {
-                    this->sentence = this->getFromHeader(lineArr[0], lineArr, length);
-                    initialised = this->sentence != NULL;
-                }
-                /* Otherwise, create the sentence as is */
-                else
-                {
-                    this->sentence = new T(lineArr, length);
-                    initialised = this->sentence->initialise(lineArr, length);
-                }
-
-                /* If the sentence was not properly initialised, set it to NULL */
-                if (!initialised)
-                {
-                    delete this->sentence;
-                    this->sentence = NULL;
-                }
-            }
-            else
-            {
-                this->sentence = NULL;
-            }
-
-            free(*lineArr);
-            free(lineArr);
-        }
-        else
-        {
-            this->sentence = NULL;
-        }
-    }
-    else
-    {
-        this->sentence = NULL;
-    }
+    this->sentence = this->parsed.template as<T>();
 }
 
 /**
@@ -98,382 +96,325 @@ T * const Sentence<T>::getSentence()
 }
 
 /**
- * Verifies the format of the given NMEA message using regex.
- *
- * @param data The message to check for the correct format
- *
- * @returns 0 if the message is of the correct format, -1 if it is not
- * 			and -2 if the input is NULL.
+ * A method to statically assert that the `Sentence` `T` type is an accepted type. This `T` type must 
+ * be either a child of a `BASE` class, or a child of a `GROUP` class.
  */
 template <typename T>
-int8_t Sentence<T>::verifyFormat(const char *data)
+inline void Sentence<T>::assertCorrectType()
 {
-    /* Compile the regex to match the format of an NMEA message (note this matches
-    both messages with \r\n at the end and without whereas a message always contains \r\n) */
-    static std::regex expr("^\\$.{2}.{3},+.*\\*.{2}(?:\r\n)?$", std::regex_constants::ECMAScript);
-    bool res;
+    static_assert(
+        std::is_base_of_v<BASE, T> ||
+        std::is_base_of_v<GROUP, T>,
+        "Ensure that the given type is an accepted type (BASE, or a GROUP type)"
+    );
+}
 
-    if (data == NULL)
-    {
-        return -2;
-    }
+/* ---------------------- End Sentence Definitions ---------------------- */
 
-    std::string input = data;
-    std::smatch match;
+/* -------------------- ParsedSentence Definitions ---------------------- */
 
-    res = std::regex_match(input, match, expr);
+/**
+ * Views the parsed sentence as the given type `T`. The type may either be a concrete sentence type (eg.
+ * `GGA`), or a `GROUP` type (eg. `POS`). No data is copied - the returned pointer refers to the sentence
+ * held by this object and is only valid for as long as this object is.
+ * 
+ * @returns A pointer to the sentence as type `T` if the sentence belongs to `T`, or `NULL` otherwise.
+ */
+template <typename T>
+T * const ParsedSentence::as()
+{
+    static_assert(
+        std::is_base_of_v<BASE, T> ||
+        std::is_base_of_v<GROUP, T>,
+        "Ensure that the given type is an accepted type (BASE, or a GROUP type)"
+    );
 
-    if (res)
+    /* The sentence does not belong to T */
+    if (this->sentence == NULL || (T::acceptedTypes & NMEA_ID::bit(this->type)) == 0)
     {
-        return 0;
+        return NULL;
     }
 
-    return -1;
+    switch (this->type)
+    {
+        case NMEA_DTM: return this->project<T, DTM>();
+        case NMEA_GAQ: return this->project<T, GAQ>();
+        case NMEA_GBQ: return this->project<T, GBQ>();
+        case NMEA_GBS: return this->project<T, GBS>();
+        case NMEA_GGA: return this->project<T, GGA>();
+        case NMEA_GLL: return this->project<T, GLL>();
+        case NMEA_GLQ: return this->project<T, GLQ>();
+        case NMEA_GNQ: return this->project<T, GNQ>();
+        case NMEA_GNS: return this->project<T, GNS>();
+        case NMEA_GPQ: return this->project<T, GPQ>();
+        case NMEA_GRS: return this->project<T, GRS>();
+        case NMEA_GSA: return this->project<T, GSA>();
+        case NMEA_GST: return this->project<T, GST>();
+        case NMEA_GSV: return this->project<T, GSV>();
+        case NMEA_RLM: return this->project<T, RLM>();
+        case NMEA_RMC: return this->project<T, RMC>();
+        case NMEA_TXT: return this->project<T, TXT>();
+        case NMEA_VLW: return this->project<T, VLW>();
+        case NMEA_VTG: return this->project<T, VTG>();
+        case NMEA_ZDA: return this->project<T, ZDA>();
+        default: return NULL;
+    }
 }
 
 /**
- * This converts the given lineArr according to the given header to the type required by the `Sentence`
- * object. If the given sentence is not the required type, it will return `NULL`. This method also
- * casts the found sentence type to the required type as defined in the `Sentence` object.
+ * Constructs the sentence of the concrete type `S` in place and parses it from the given line using the
+ * schema of `S`. If the sentence is invalid, it is destroyed again.
  * 
- * For example:
- * If the given NMEA sentence is: $GNGLL,1234.56789,S,12345.67891,E,123456.78,A,D*66
- * And the sentence object is of the type: Sentence<POS>
- * Then the method will return a `POS` object with the data read in from the NMEA sentence.
- * ie.
- *      POS{1234.56789, S, 12345.67891, E}
- * 
- * @param header The header to use for comparisons. This must include the '$' symbol and the constellation.
- * @param lineArr The already-split array for the sentence.
- * @param length The length of the `lineArr`.
- * 
- * @returns A pointer to a sentence of the type `T` from `Sentence` if the given sentence is valid, or
- *          `NULL` if the given sentence is invalid.
- * 
- * @note This is mostly used to ensure that sentences can belong to a `GROUP` and be initialise as such
- * @note The header should be the entire header and must be completely accessible memory-wise
- * @note Any `STD_MSG_POLL` sentences are currently not considered
+ * @returns The parsed sentence, or `NULL` if the sentence is invalid.
  */
-template <typename T>
-T * Sentence<T>::getFromHeader(const char * const header, char ** lineArr, uint16_t length)
+template <typename S>
+BASE * ParsedSentence::emplace(const NMEALine * const line)
 {
-    bool initialised = false;
-    T * found = NULL;
+    S& sentence = this->storage.template emplace<S>();
 
-    /* NOTE: Can replace with switch-case later, however a significant performance increase may not be observed */
-    if (strncmp(header + 3, (char *) "DTM", 3) == 0)
+    if (!S::Schema::parse(sentence, line))
     {
-        if (std::is_base_of_v<T, DTM>)
-        {
-            DTM * sent = new DTM(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    /* else if (strncmp(header + 3, (char *) "GAQ", 3) == 0)
-    {
-        if (std::is_base_of_v<T, GAQ>)
-        {
-            GAQ * sent = new GAQ(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "GBQ", 3) == 0)
-    {
-        if (std::is_base_of_v<T, GBQ>)
-        {
-            GBQ * sent = new GBQ(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } */
-    else if (strncmp(header + 3, (char *) "GBS", 3) == 0)
-    {
-        if (std::is_base_of_v<T, GBS>)
-        {
-            GBS * sent = new GBS(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "GGA", 3) == 0)
+        this->storage.template emplace<std::monostate>();
+        return NULL;
+    }
+
+    return &sentence;
+}
+
+/**
+ * Projects the stored sentence, which is known to be of the concrete type `S`, to the type `T`. The
+ * projection is resolved at compile time and points into the in-place storage, so nothing is copied.
+ * 
+ * @returns A pointer to the sentence as type `T` if `S` belongs to `T`, or `NULL` otherwise.
+ */
+template <typename T, typename S>
+T * const ParsedSentence::project()
+{
+    if constexpr (std::is_base_of_v<T, S>)
     {
-        if (std::is_base_of_v<T, GGA>)
-        {
-            GGA * sent = new GGA(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "GLL", 3) == 0)
+        return std::get_if<S>(&this->storage);
+    }
+    else
     {
-        if (std::is_base_of_v<T, GLL>)
-        {
-            GLL * sent = new GLL(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    /* else if (strncmp(header + 3, (char *) "GLQ", 3) == 0)
+        return NULL;
+    }
+}
+
+/* ------------------ End ParsedSentence Definitions -------------------- */
+/* --------------------- NMEA_SCHEMA Definitions ------------------------ */
+
+namespace NMEA_SCHEMA
+{
+    /**
+     * Retrieves the field at the given index, where a negative index counts back from the last field.
+     */
+    template <int8_t index>
+    inline StrSpan getField(const StrSpan * fields, uint16_t length)
     {
-        if (std::is_base_of_v<T, GLQ>)
-        {
-            GLQ * sent = new GLQ(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "GNQ", 3) == 0)
+        if constexpr (index >= 0)
+            return fields[index];
+        else
+            return fields[length + index];
+    }
+
+    /**
+     * Parses a numeric field immediately.
+     */
+    template <typename T>
+    inline void parseNumber(StrSpan span, Field<T>& field, uint8_t base)
     {
-        if (std::is_base_of_v<T, GNQ>)
-        {
-            GNQ * sent = new GNQ(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } */
-    else if (strncmp(header + 3, (char *) "GNS", 3) == 0)
+        strtonumber(span, field, base);
+    }
+
+    /**
+     * Records a numeric field, and its base, to be decoded when it is first read (see `LazyField`).
+     */
+    template <typename T>
+    inline void parseNumber(StrSpan span, LazyField<T>& field, uint8_t base)
     {
-        if (std::is_base_of_v<T, GNS>)
-        {
-            GNS * sent = new GNS(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    /* else if (strncmp(header + 3, (char *) "GPQ", 3) == 0)
+        field.setSource(span, base);
+    }
+
+    /**
+     * Applies the check `Check` to a parsed field. If the field is valid but not accepted by the check,
+     * the field is marked as invalid.
+     * 
+     * @returns `false` if the check is required and the field is either invalid or not accepted, or
+     *          `true` otherwise.
+     */
+    template <typename Check, typename T>
+    inline bool applyCheck(Field<T>& field)
     {
-        if (std::is_base_of_v<T, GPQ>)
+        const T * const value = field.getValue();
+        bool accepted = value != NULL && Check::accepts(*value);
+
+        if (value != NULL && !accepted)
         {
-            GPQ * sent = new GPQ(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
+            field.setValue(*value, false);
         }
-    } */
-    else if (strncmp(header + 3, (char *) "GRS", 3) == 0)
+
+        return accepted || !Check::REQUIRED;
+    }
+
+    /**
+     * A `LazyField` is not decoded when parsed, so it cannot be checked. Any field that must be checked
+     * should be declared as a `Field` instead.
+     */
+    template <typename Check, typename T>
+    inline bool applyCheck(LazyField<T>&)
     {
-        if (std::is_base_of_v<T, GRS>)
-        {
-            GRS * sent = new GRS(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "GSA", 3) == 0)
+        static_assert(std::is_same_v<Check, Any>, "Ensure that checked fields are not declared as a LazyField");
+
+        return true;
+    }
+
+    template <auto member, int8_t index, typename Check, uint8_t base>
+    template <typename S>
+    bool Number<member, index, Check, base>::parse(S& sentence, const StrSpan * fields, uint16_t length)
     {
-        if (std::is_base_of_v<T, GSA>)
-        {
-            GSA * sent = new GSA(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "GST", 3) == 0)
+        auto& field = sentence.*member;
+
+        parseNumber(getField<index>(fields, length), field, base);
+
+        return applyCheck<Check>(field);
+    }
+
+    template <auto member, int8_t index, typename Check>
+    template <typename S>
+    bool Char<member, index, Check>::parse(S& sentence, const StrSpan * fields, uint16_t length)
     {
-        if (std::is_base_of_v<T, GST>)
-        {
-            GST * sent = new GST(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "GSV", 3) == 0)
+        StrSpan span = getField<index>(fields, length);
+        Field<char>& field = sentence.*member;
+
+        field.setValue(span.length > 0 ? span.str[0] : '\0', span.length == 1);
+
+        return applyCheck<Check>(field);
+    }
+
+    template <auto member, int8_t index>
+    template <typename S>
+    bool Text<member, index>::parse(S& sentence, const StrSpan * fields, uint16_t length)
     {
-        if (std::is_base_of_v<T, GSV>)
-        {
-            GSV * sent = new GSV(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "RLM", 3) == 0)
+        StrSpan span = getField<index>(fields, length);
+
+        (sentence.*member).setValue(std::string(span.str, span.length), span.length > 0);
+
+        return true;
+    }
+
+    template <auto member, int8_t index>
+    template <typename S>
+    bool Time<member, index>::parse(S& sentence, const StrSpan * fields, uint16_t length)
     {
-        if (std::is_base_of_v<T, RLM>)
-        {
-            RLM * sent = new RLM(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "RMC", 3) == 0)
+        StrSpan span = getField<index>(fields, length);
+
+        (sentence.*member).setValue(std::string(span.str, span.length), TIME::checkTimeFormat(span));
+
+        return true;
+    }
+
+    template <auto member, int8_t index, uint8_t maxDegrees>
+    template <typename S>
+    bool Coordinate<member, index, maxDegrees>::parse(S& sentence, const StrSpan * fields, uint16_t length)
     {
-        if (std::is_base_of_v<T, RMC>)
-        {
-            RMC * sent = new RMC(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "TXT", 3) == 0)
+        POS::parseCoordinate(getField<index>(fields, length), sentence.*member, maxDegrees);
+
+        return true;
+    }
+
+    template <auto member, int8_t index>
+    template <typename S>
+    bool CoordinateOffset<member, index>::parse(S& sentence, const StrSpan * fields, uint16_t length)
     {
-        if (std::is_base_of_v<T, TXT>)
-        {
-            TXT * sent = new TXT(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    } 
-    else if (strncmp(header + 3, (char *) "VLW", 3) == 0)
+        POS::parseCoordinateOffset(getField<index>(fields, length), sentence.*member);
+
+        return true;
+    }
+
+    template <auto member, int8_t first, uint8_t count>
+    template <typename S>
+    bool Array<member, first, count>::parse(S& sentence, const StrSpan * fields, uint16_t)
     {
-        if (std::is_base_of_v<T, VLW>)
+        auto& array = sentence.*member;
+
+        static_assert(std::extent_v<std::remove_reference_t<decltype(array)>> == count, "Ensure the array holds every field");
+
+        for (uint8_t i = 0; i < count; i++)
         {
-            VLW * sent = new VLW(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
+            strtonumber(fields[first + i], array[i]);
         }
-    } 
-    else if (strncmp(header + 3, (char *) "VTG", 3) == 0)
+
+        return true;
+    }
+
+    template <auto member, auto count, int8_t first, uint8_t nTrailing>
+    template <typename S>
+    bool Satellites<member, count, first, nTrailing>::parse(S& sentence, const StrSpan * fields, uint16_t length)
     {
-        if (std::is_base_of_v<T, VTG>)
+        auto& satellites = sentence.*member;
+        constexpr uint8_t MAX_SATELLITES = std::extent_v<std::remove_reference_t<decltype(satellites)>>;
+        uint16_t nFields = length - first - nTrailing;
+        uint8_t n = 0;
+
+        /* The satellites must be given as complete groups of 4 fields */
+        if (nFields % 4 != 0 || nFields / 4 > MAX_SATELLITES)
         {
-            VTG * sent = new VTG(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
+            return false;
         }
-    } 
-    else if (strncmp(header + 3, (char *) "ZDA", 3) == 0)
-    {
-        if (std::is_base_of_v<T, ZDA>)
+
+        for (n = 0; n < nFields / 4; n++)
         {
-            ZDA * sent = new ZDA(lineArr, length);
-            initialised = sent->initialise(lineArr, length);
-            found = new T(*((T *) sent));
-            delete sent;
-            sent = NULL;
-        }
-    }
+            const StrSpan * group = fields + first + n * 4;
+            Field<uint8_t> svid, elv, cno;
+            Field<uint16_t> az;
 
-    if (!initialised)
-    {
-        delete found;
-        found = NULL;
-    }
+            /* Each conversion ensures that the entire integer was consumed */
+            strtonumber(group[0], svid);
+            strtonumber(group[1], elv);
+            strtonumber(group[2], az);
+            strtonumber(group[3], cno);
 
-    return found;
-}
+            SatData data = {
+                .svid = svid.getValid() ? *svid.getValue() : (uint8_t) 0,
+                .elv = elv.getValid() ? *elv.getValue() : (uint8_t) 0,
+                .az = az.getValid() ? *az.getValue() : (uint16_t) 0,
+                .cno = cno.getValid() ? *cno.getValue() : (uint8_t) 0
+            };
 
-/**
- * A method to statically assert that the `Sentence` `T` type is an accepted type. This `T` type must 
- * be either a child of a `BASE` class, or a child of a `GROUP` class.
- */
-template <typename T>
-inline void Sentence<T>::assertCorrectType()
-{
-    static_assert(
-        std::is_base_of_v<BASE, T> ||
-        std::is_base_of_v<GROUP, T>,
-        "Ensure that the given type is an accepted type (BASE, or a GROUP type)"
-    );
-}
+            satellites[n].setValue(data, svid.getValid() && elv.getValid() && az.getValid() && cno.getValid());
+        }
 
-/**
- * A method to determine whether the given header can be found in the `Sentence` `T` type's accepted
- * types vector.
- * 
- * @param header The header to verify. This is the entire header including the '$' symbol and constellation
- * 
- * @returns `true` if the given header is in the `T::acceptedTypes` vector, or `false` otherwise
- * 
- * @note The type `T` must implement a static field that contains the accepted type headers.
- */
-template <typename T>
-bool Sentence<T>::isAcceptedSubtype(char * header)
-{
-    this->assertCorrectType();
+        sentence.*count = n;
 
-    for (std::string s : T::acceptedTypes)
-    {
-        /* If the given header is found in the accepted types, return true */
-        if (s.compare(0, 3, header, 3, 3) == 0)
-        {
-            return true;
-        }
+        return true;
     }
 
-    return false;
-}
-
-/**
- * A method to determine whether the checksum of the given sentence is valid or not. This follows the
- * NMEA checksum formula as described in the Interface Description of the NEOM9N Module.
- * 
- * @param data The NMEA sentence string, including the checksum (ie. from '$' to "\r\n")
- * 
- * @returns `0` if the calculated checksum from the given sentence equals the checksum at the end of the
- *          given sentence and `-1` otherwise.
- */
-template <typename T>
-int8_t Sentence<T>::nmeaChecksum(const char *data)
-{
-    uint16_t i = 0;
-    uint8_t check = 0;
-    const char * checksumRegion = strchr(data, '$') + 1;
-    const char * checksumPos = strchr(data, '*');
-    if (checksumPos != NULL)
+    /**
+     * Parses the given line into the sentence. The number of fields is checked against the bounds of the
+     * schema first, so that no field is read out of bounds. Each field is then parsed and checked in the
+     * order of the schema, stopping at the first field that makes the sentence invalid.
+     * 
+     * @param sentence The sentence to parse the line into.
+     * @param line The scanned sentence, as produced by `scanNMEA`.
+     * 
+     * @returns `true` if the sentence is valid, or `false` otherwise.
+     */
+    template <uint8_t minFields, uint8_t maxFields, typename... Fields>
+    template <typename S>
+    bool Schema<minFields, maxFields, Fields...>::parse(S& sentence, const NMEALine * const line)
     {
-        while(checksumRegion[i] != '*')
+        if (line->length < minFields || line->length > maxFields)
         {
-            check ^= (uint8_t) checksumRegion[i];
-            i++;
+            return false;
         }
 
-        if (check == (uint8_t) strtol(checksumPos + 1, NULL, 16))
+        if (!sentence.initialise(line))
         {
-            return 0;
+            return false;
         }
-    }
 
-    return -1;
-}
-
-/**
- * The destructor for the `Sentence` class. This deletes the sentence if it was allocated and sets
- * the value to `NULL`
- */
-template <typename T>
-Sentence<T>::~Sentence()
-{
-    delete this->sentence;
-    this->sentence = NULL;
+        return (Fields::parse(sentence, line->fields, line->length) && ...);
+    }
 }
 
-/* ---------------------- End Sentence Definitions ---------------------- */
\ No newline at end of file
+/* ------------------- End NMEA_SCHEMA Definitions ---------------------- */
@@ -1,4 +1,5 @@
 #include "stringslib.h"
+#include "buffer.h"
 
 /**
  * Similar to `strsep` - updates the input string to point past the
@@ -42,30 +43,17 @@ char * strnext(char ** input, const char * delim)
 uint16_t numTokens(const char *string, const char * token)
 {
 	uint16_t nTokens = 0;
-	uint16_t i = 0;
-	uint8_t tokenLength = strlen(token);
+	size_t stringLength = strlen(string);
+	size_t tokenLength = strlen(token);
+	const uint8_t * found = (const uint8_t *) string;
 
-	/* If the string is not longer than the token, return */
-	if (strlen(string) < tokenLength)
+	/* Instances may overlap, so each search starts from the character after the previous instance */
+	while ((found = findInSegments(found, stringLength - (found - (const uint8_t *) string), NULL, 0, (const uint8_t *) token, tokenLength)) != NULL)
 	{
-		return 0;
+		nTokens++;
+		found++;
 	}
 
-	char * substr = (char *) calloc(tokenLength + 1, sizeof(char));
-
-	/* Scan the string for instances of the token, ending with the final token size */
-	for (i = 0; i < strlen(string) - tokenLength + 1; i++)
-	{
-		substr = strncpy(substr, &(string[i]), tokenLength);
-
-		if (strcmp(token, substr) == 0)
-		{
-			nTokens++;
-		}
-	}
-
-	free(substr);
-
 	return nTokens;
 }
 
@@ -146,4 +134,55 @@ char ** splitString(const char * string, const char * delim, uint16_t * arr_size
 
 
 	return strings;
+}
+
+/**
+ * Splits the given string into sections at each instance of delim. Unlike `splitString`, this does not
+ * allocate or modify any memory - each section is recorded as a `StrSpan` pointing into `string`.
+ * The string is scanned exactly once.
+ *
+ * @param string The string that is going to be split.
+ * @param length The number of characters of `string` to split. The string does not need to be null
+ * 				 terminated at this position.
+ * @param delim The delimiter character to split at.
+ * @param spans The array to populate with the sections of the string.
+ * @param maxSpans The capacity of `spans`.
+ *
+ * @returns The number of sections found in the string. If this is greater than `maxSpans`, only the
+ * 			first `maxSpans` sections were recorded and the split should be treated as incomplete.
+ *
+ * @note For n delimiters there are always n+1 sections, including empty sections. For example,
+ * 		 "A,,B" becomes ["A", "", "B"].
+ */
+uint16_t splitSpans(const char * string, size_t length, char delim, StrSpan * spans, uint16_t maxSpans)
+{
+	uint16_t nSpans = 0;
+	size_t start = 0;
+
+	while (start <= length)
+	{
+		/* Either the next delimiter or the end of the string closes the current section */
+		const char * found = (const char *) memchr(string + start, delim, length - start);
+		size_t end = found != NULL ? (size_t) (found - string) : length;
+
+		if (nSpans < maxSpans)
+		{
+			spans[nSpans].str = string + start;
+			spans[nSpans].length = (uint16_t) (end - start);
+		}
+
+		nSpans++;
+		start = end + 1;
+	}
+
+	return nSpans;
+}
+
+/**
+ * Returns the first character of the given span, or '\0' if the span is empty. This mirrors reading
+ * the first character of a null terminated field.
+ */
+char firstChar(StrSpan span)
+{
+	return span.length > 0 ? span.str[0] : '\0';
 }
\ No newline at end of file
@@ -1,153 +1,118 @@
 #include "stringslib.hpp"
 
 /* Private Function Declarations */
-template <typename T>
-void strtounsigned(const char * const str, const Field<T>&, uint64_t MAX_VAL, uint8_t base);
-bool verifyUnsigned(const char * const str, const char * const endptr, unsigned long long val, uint64_t MAX_VAL);
-template <typename T>
-void strtosigned(const char * const str, const Field<T>& field, int64_t MIN_VAL, int64_t MAX_VAL, uint8_t base);
-bool verifySigned(const char * const str, const char * const endptr, signed long long val, int64_t MIN_VAL, int64_t MAX_VAL);
+static inline StrSpan toSpan(const char * const str);
 /* End Private Function Declarations */
 
-/**
- * Converts a C string to an unsigned long long and places the value in the given field.
- */
-template <typename T>
-void strtounsigned(const char * const str, Field<T>& field, uint64_t MAX_VAL, uint8_t base)
-{
-    char * endptr;
-    unsigned long long val = 0;
-    bool valid = false;
-
-    val = strtoull(str, &endptr, base);
-
-    valid = verifyUnsigned(str, endptr, val, MAX_VAL);
-
-    field.setValue((T) val, valid);
-}
+/* Compile-time checks of the span parsers */
+static_assert([] { uint64_t v = 0; return parseUnsigned({"255", 3}, UINT8_MAX, v) && v == 255; }());
+static_assert([] { uint64_t v = 0; return !parseUnsigned({"256", 3}, UINT8_MAX, v) && !parseUnsigned({"-1", 2}, UINT8_MAX, v); }());
+static_assert([] { int64_t v = 0; return parseSigned({"-128", 4}, INT8_MIN, INT8_MAX, v) && v == -128; }());
+static_assert([] { int64_t v = 0; return !parseSigned({"-129", 4}, INT8_MIN, INT8_MAX, v) && !parseSigned({"-", 1}, INT8_MIN, INT8_MAX, v); }());
+static_assert([] { double v = 0; return parseDecimal({"-12.5", 5}, v) && v == -12.5; }());
+static_assert([] { double v = 0; return !parseDecimal({"1.2.3", 5}, v) && !parseDecimal({".", 1}, v); }());
 
 /**
- * Verifies that the given string is an unsigned integer.
+ * Creates a span of the given C string, or an empty span if the string is NULL.
  */
-bool verifyUnsigned(const char * const str, const char * const endptr, unsigned long long val, uint64_t MAX_VAL)
+static inline StrSpan toSpan(const char * const str)
 {
-    // If the entire string was not consumed, return false
-    if (*endptr != '\0' || *str == '\0')
-    {
-        return false;
-    }
-
-    // If the given value is negative, return false
-    if (*str == '-')
-    {
-        return false;
-    }
+    StrSpan span = {str, 0};
 
-    // If the given value is greater than the max value, return false
-    if (val > MAX_VAL)
+    if (str != NULL)
     {
-        return false;
+        span.length = (uint16_t) strnlen(str, UINT16_MAX);
     }
 
-    return true;
+    return span;
 }
 
 void strtouint8(const char * const str, Field<uint8_t>& field, uint8_t base)
 {
-    strtounsigned<uint8_t>(str, field, UINT8_MAX, base);
+    strtouint8(toSpan(str), field, base);
 }
 
 void strtouint16(const char * const str, Field<uint16_t>& field, uint8_t base)
 {
-    strtounsigned<uint16_t>(str, field, UINT16_MAX, base);
+    strtouint16(toSpan(str), field, base);
 }
 
 void strtouint32(const char * const str, Field<uint32_t>& field, uint8_t base)
 {
-    strtounsigned<uint32_t>(str, field, UINT32_MAX, base);
+    strtouint32(toSpan(str), field, base);
 }
 
 void strtouint64(const char * const str, Field<uint64_t>& field, uint8_t base)
 {
-    strtounsigned<uint64_t>(str, field, UINT64_MAX, base);
+    strtouint64(toSpan(str), field, base);
 }
 
-template <typename T>
-void strtosigned(const char * const str, Field<T>& field, int64_t MIN_VAL, int64_t MAX_VAL, uint8_t base)
+void strtoint8(const char * const str, Field<int8_t>& field, uint8_t base)
 {
-    char * endptr;
-    signed long long val = 0;
-    bool valid = false;
-
-    val = strtoull(str, &endptr, base);
-
-    valid = verifySigned(str, endptr, val, MIN_VAL, MAX_VAL);
-
-    field.setValue((T) val, valid);
+    strtoint8(toSpan(str), field, base);
 }
 
-bool verifySigned(const char * const str, const char * const endptr, signed long long val, int64_t MIN_VAL, int64_t MAX_VAL)
+void strtoint16(const char * const str, Field<int16_t>& field, uint8_t base)
 {
-    // If the entire string was not consumed, return false
-    if (*endptr != '\0' || *str == '\0')
-    {
-        return false;
-    }
-
-    // If the given value is greater than the max value or smaller than the min value, return false
-    if (val > MAX_VAL || val < MIN_VAL)
-    {
-        return false;
-    }
+    strtoint16(toSpan(str), field, base);
+}
 
-    return true;
+void strtoint32(const char * const str, Field<int32_t>& field, uint8_t base)
+{
+    strtoint32(toSpan(str), field, base);
 }
 
-void strtoint8(const char * const str, Field<int8_t>& field, uint8_t base)
+void strtofloat(const char * const str, Field<float_t>& field)
 {
-    strtosigned<int8_t>(str, field, INT8_MIN, INT8_MAX, base);
+    strtofloat(toSpan(str), field);
 }
 
-void strtoint16(const char * const str, Field<int16_t>& field, uint8_t base)
+void strtodouble(const char * const str, Field<double_t>& field)
 {
-    strtosigned<int16_t>(str, field, INT16_MIN, INT16_MAX, base);
+    strtodouble(toSpan(str), field);
 }
 
-void strtoint32(const char * const str, Field<int32_t>& field, uint8_t base)
+void strtouint8(StrSpan str, Field<uint8_t>& field, uint8_t base)
 {
-    strtosigned<int32_t>(str, field, INT32_MIN, INT32_MAX, base);
+    strtonumber(str, field, base);
 }
 
-void strtofloat(const char * const str, Field<float_t>& field)
+void strtouint16(StrSpan str, Field<uint16_t>& field, uint8_t base)
 {
-    char * endptr;
-    float_t val = 0;
-    bool valid = false;
+    strtonumber(str, field, base);
+}
 
-    val = strtof(str, &endptr);
+void strtouint32(StrSpan str, Field<uint32_t>& field, uint8_t base)
+{
+    strtonumber(str, field, base);
+}
 
-    // If the entire string was consumed, set valid to true
-    if (*endptr == '\0' && *str != '\0')
-    {
-        valid = true;
-    }
+void strtouint64(StrSpan str, Field<uint64_t>& field, uint8_t base)
+{
+    strtonumber(str, field, base);
+}
 
-    field.setValue(val, valid);
+void strtoint8(StrSpan str, Field<int8_t>& field, uint8_t base)
+{
+    strtonumber(str, field, base);
 }
 
-void strtodouble(const char * const str, Field<double_t>& field)
+void strtoint16(StrSpan str, Field<int16_t>& field, uint8_t base)
 {
-    char * endptr;
-    double_t val = 0;
-    bool valid = false;
+    strtonumber(str, field, base);
+}
 
-    val = strtod(str, &endptr);
+void strtoint32(StrSpan str, Field<int32_t>& field, uint8_t base)
+{
+    strtonumber(str, field, base);
+}
 
-    // If the entire string was consumed, set valid to true
-    if (*endptr == '\0' && *str != '\0')
-    {
-        valid = true;
-    }
+void strtofloat(StrSpan str, Field<float_t>& field)
+{
+    strtonumber(str, field);
+}
 
-    field.setValue(val, valid);
+void strtodouble(StrSpan str, Field<double_t>& field)
+{
+    strtonumber(str, field);
 }
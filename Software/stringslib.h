@@ -11,9 +11,21 @@ extern "C"
 {
 #endif
 
+/**
+ * A view of a section of a larger string. The section is NOT null terminated, so `length` must be
+ * used to bound any reads from `str`.
+ */
+typedef struct
+{
+	const char * str;	// The start of the section
+	uint16_t length;	// The number of characters in the section
+} StrSpan;
+
 char * strnext(char ** input, const char * delim);
 uint16_t numTokens(const char* string, const char * token);
 char ** splitString(const char * string, const char * delim, uint16_t * arr_size);
+uint16_t splitSpans(const char * string, size_t length, char delim, StrSpan * spans, uint16_t maxSpans);
+char firstChar(StrSpan span);
 
 #ifdef __cplusplus
 }
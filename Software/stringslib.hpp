@@ -2,10 +2,13 @@
 #define INC_STRINGSLIB_HPP_
 
 #include <cmath>
+#include <limits>
+#include <type_traits>
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
 #include "data_validation.hpp"
+#include "stringslib.h"
 
 void strtouint8(const char * const str, Field<uint8_t>& field, uint8_t base=10);
 void strtouint16(const char * const str, Field<uint16_t>& field, uint8_t base=10);
@@ -17,4 +20,28 @@ void strtoint32(const char * const str, Field<int32_t>& field, uint8_t base=10);
 void strtofloat(const char * const str, Field<float_t>& field);
 void strtodouble(const char * const str, Field<double_t>& field);
 
+void strtouint8(StrSpan str, Field<uint8_t>& field, uint8_t base=10);
+void strtouint16(StrSpan str, Field<uint16_t>& field, uint8_t base=10);
+void strtouint32(StrSpan str, Field<uint32_t>& field, uint8_t base=10);
+void strtouint64(StrSpan str, Field<uint64_t>& field, uint8_t base=10);
+void strtoint8(StrSpan str, Field<int8_t>& field, uint8_t base=10);
+void strtoint16(StrSpan str, Field<int16_t>& field, uint8_t base=10);
+void strtoint32(StrSpan str, Field<int32_t>& field, uint8_t base=10);
+void strtofloat(StrSpan str, Field<float_t>& field);
+void strtodouble(StrSpan str, Field<double_t>& field);
+
+constexpr int8_t digitValue(char c, uint8_t base);
+constexpr bool parseUnsigned(StrSpan str, uint64_t maxValue, uint64_t& value, uint8_t base = 10);
+constexpr bool parseSigned(StrSpan str, int64_t minValue, int64_t maxValue, int64_t& value, uint8_t base = 10);
+template <typename T> constexpr bool parseDecimal(StrSpan str, T& value);
+template <typename T> void strtonumber(StrSpan str, Field<T>& field, uint8_t base = 10);
+
+/* Include the constexpr implementation after declaration
+ * NOTE: constexpr functions must be defined wherever they are used, so the implementation is
+ *       included in the header in the same way as the template implementations.
+ * NOTE: Do NOT include stringslib.tpp at the beginning of this file or at any point
+ *       in other header files.
+ */
+#include "stringslib.tpp"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,220 @@
+/**
+ * FILE: stringslib.tpp
+ * PURPOSE: To serve as the implementation file for the constexpr span parsers declared in stringslib.hpp
+ *
+ * UPDATED: 17 Oct. 2026
+ *
+ * NOTE: Do NOT include this file other than at the end of stringslib.hpp.
+ *       Any other includes may lead to issues.
+ */
+
+/* ----------------------- Span Parser Definitions ---------------------- */
+
+/**
+ * Converts a single character to its digit value in the given base.
+ *
+ * @returns The value of the digit, or -1 if the character is not a digit in the given base.
+ */
+constexpr int8_t digitValue(char c, uint8_t base)
+{
+    int8_t value = -1;
+
+    if (c >= '0' && c <= '9')
+        value = c - '0';
+    else if (c >= 'A' && c <= 'Z')
+        value = c - 'A' + 10;
+    else if (c >= 'a' && c <= 'z')
+        value = c - 'a' + 10;
+
+    return (value >= 0 && value < base) ? value : -1;
+}
+
+/**
+ * Parses an unsigned integer from the given span. The entire span must be digits of the given base (no
+ * sign, whitespace or prefix) and the value must not be greater than `maxValue`.
+ *
+ * @param str The span to parse.
+ * @param maxValue The largest valid value.
+ * @param value The parsed value. This is only set if the span is valid.
+ * @param base The base of the integer (2 - 36).
+ *
+ * @returns `true` if the span is a valid unsigned integer, or `false` otherwise.
+ */
+constexpr bool parseUnsigned(StrSpan str, uint64_t maxValue, uint64_t& value, uint8_t base)
+{
+    uint64_t result = 0;
+    uint16_t i;
+
+    if (str.str == NULL || str.length == 0 || base < 2 || base > 36)
+    {
+        return false;
+    }
+
+    for (i = 0; i < str.length; i++)
+    {
+        int8_t digit = digitValue(str.str[i], base);
+
+        /* Not a digit, or the value would exceed the maximum value */
+        if (digit < 0 || (uint64_t) digit > maxValue || result > (maxValue - digit) / base)
+        {
+            return false;
+        }
+
+        result = result * base + digit;
+    }
+
+    value = result;
+
+    return true;
+}
+
+/**
+ * Parses a signed integer from the given span. The span may begin with a single '+' or '-', followed by
+ * digits of the given base only, and the value must be between `minValue` and `maxValue` inclusive.
+ *
+ * @param str The span to parse.
+ * @param minValue The smallest valid value (must not be positive).
+ * @param maxValue The largest valid value (must not be negative).
+ * @param value The parsed value. This is only set if the span is valid.
+ * @param base The base of the integer (2 - 36).
+ *
+ * @returns `true` if the span is a valid signed integer, or `false` otherwise.
+ */
+constexpr bool parseSigned(StrSpan str, int64_t minValue, int64_t maxValue, int64_t& value, uint8_t base)
+{
+    bool negative = false;
+    uint64_t magnitude = 0;
+
+    if (str.str != NULL && str.length > 0 && (str.str[0] == '-' || str.str[0] == '+'))
+    {
+        negative = str.str[0] == '-';
+        str.str++;
+        str.length--;
+    }
+
+    /* The magnitude of the minimum value is computed without negating it, as -INT64_MIN overflows */
+    if (!parseUnsigned(str, negative ? (uint64_t) (-(minValue + 1)) + 1 : (uint64_t) maxValue, magnitude, base))
+    {
+        return false;
+    }
+
+    value = negative ? (int64_t) (0 - magnitude) : (int64_t) magnitude;
+
+    return true;
+}
+
+/**
+ * Parses a decimal number (eg. "-123.45") from the given span. The span may begin with a single '+' or
+ * '-', followed by digits with at most one decimal point. Exponents, whitespace, "inf" and "nan" are
+ * not accepted as they never appear in NMEA fields. The conversion does not depend on the locale.
+ *
+ * @param str The span to parse.
+ * @param value The parsed value. This is only set if the span is valid.
+ *
+ * @returns `true` if the span is a valid decimal number, or `false` otherwise.
+ *
+ * @note Digits beyond the 19th significant digit or 19th decimal place are ignored.
+ */
+template <typename T>
+constexpr bool parseDecimal(StrSpan str, T& value)
+{
+    constexpr T POW10[] = {
+        1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+        1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19
+    };
+    uint64_t mantissa = 0;
+    uint8_t nSignificant = 0, nFraction = 0;
+    bool negative = false, point = false, digits = false;
+    uint16_t i = 0;
+
+    if (str.str == NULL || str.length == 0)
+    {
+        return false;
+    }
+
+    if (str.str[0] == '-' || str.str[0] == '+')
+    {
+        negative = str.str[0] == '-';
+        i++;
+    }
+
+    for (; i < str.length; i++)
+    {
+        char c = str.str[i];
+
+        if (c == '.' && !point)
+        {
+            point = true;
+            continue;
+        }
+
+        if (c < '0' || c > '9')
+        {
+            return false;
+        }
+
+        digits = true;
+
+        /* Too many decimal places or significant digits to be represented, so ignore the digit */
+        if (point && (nFraction >= 19 || nSignificant >= 19))
+            continue;
+
+        /* Too many integer digits to be represented */
+        if (!point && nSignificant >= 19)
+            return false;
+
+        /* Leading zeros are not significant */
+        if (mantissa != 0 || c != '0')
+        {
+            mantissa = mantissa * 10 + (c - '0');
+            nSignificant++;
+        }
+
+        nFraction += point ? 1 : 0;
+    }
+
+    if (!digits)
+    {
+        return false;
+    }
+
+    value = (T) mantissa / POW10[nFraction];
+    value = negative ? -value : value;
+
+    return true;
+}
+
+/**
+ * Converts a span to the numeric type of the given field, using the span parser for that type, and
+ * places the value in the field. The field is invalid if the span is not entirely a valid value.
+ *
+ * @param str The span to parse.
+ * @param field The field to set.
+ * @param base The base of the value if it is an integer (2 - 36). This is ignored for decimal values.
+ */
+template <typename T>
+void strtonumber(StrSpan str, Field<T>& field, uint8_t base)
+{
+    bool valid = false;
+
+    if constexpr (std::is_floating_point_v<T>)
+    {
+        T val = 0;
+        valid = parseDecimal(str, val);
+        field.setValue(val, valid);
+    }
+    else if constexpr (std::is_unsigned_v<T>)
+    {
+        uint64_t val = 0;
+        valid = parseUnsigned(str, std::numeric_limits<T>::max(), val, base);
+        field.setValue((T) val, valid);
+    }
+    else
+    {
+        int64_t val = 0;
+        valid = parseSigned(str, std::numeric_limits<T>::min(), std::numeric_limits<T>::max(), val, base);
+        field.setValue((T) val, valid);
+    }
+}
+
+/* --------------------- END Span Parser Definitions -------------------- */
@@ -0,0 +1,130 @@
+/**
+ * FILE: transmit.hpp
+ * PURPOSE: To declare the transmit queue, which lets the main loop send bytes (eg. diagnostics or UBX
+ *          commands) without waiting for them to be transmitted.
+ *
+ * UPDATED: 17 Oct. 2026
+ */
+
+#ifndef INC_TRANSMIT_HPP_
+#define INC_TRANSMIT_HPP_
+
+#include <atomic>
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#include "ring.hpp"
+
+/* The longest message that can be formatted by `TxQueue::print` */
+#define TX_MAX_PRINT_LENGTH 256
+
+/* The default time, in the units of the queue's clock, that `TX_BLOCK` waits without making progress */
+#define TX_BLOCK_TIMEOUT 100
+
+/* What to do with a message that does not fit in the queue */
+enum TxPolicy
+{
+    TX_DROP,    // Drop the whole message, so that the caller never waits (eg. diagnostics)
+    TX_BLOCK    // Wait for the queue to be transmitted until the message fits (eg. UBX commands), unless
+                // the queue stops transmitting
+};
+
+/**
+ * The counters of a transmit queue, counting from start up.
+ */
+struct TransmitStats
+{
+    uint32_t bytesQueued;       // Bytes that have been queued
+    uint32_t bytesSent;         // Bytes that have been transmitted
+    uint32_t messagesDropped;   // Messages that were dropped as the queue was full
+    uint32_t messagesBlocked;   // Messages that had to wait for the queue to be transmitted
+    uint32_t messagesAbandoned; // Messages that were only partly queued as the queue stopped transmitting
+    uint32_t transferErrors;    // Transfers that could not be started or were aborted
+    uint32_t peakFill;          // The most bytes that have been waiting in the queue at once
+};
+
+/**
+ * Starts the transfer of the given bytes, eg. using `HAL_UART_Transmit_DMA`. Once the transfer is
+ * complete, `TxQueue::complete` must be called (eg. from `HAL_UART_TxCpltCallback`), or if the transfer
+ * fails, `TxQueue::abort` (eg. from `HAL_UART_ErrorCallback`).
+ *
+ * @returns `true` if the transfer was started, or `false` otherwise.
+ */
+typedef bool (* TransmitFunction)(const uint8_t * data, size_t length, void * context);
+
+/**
+ * Returns the current time in any unit (eg. `HAL_GetTick`), used to time out `TX_BLOCK` writes.
+ */
+typedef uint32_t (* TransmitClock)();
+
+/**
+ * A queue of bytes to transmit on one channel (eg. a UART). Writing to the queue only copies the bytes
+ * into a ring and starts a transfer if none is in progress, so the caller never waits for the bytes to be
+ * sent. When a transfer completes, the next contiguous section of the queue is transmitted, so bytes that
+ * are queued while a transfer is in progress are sent together.
+ *
+ * For example:
+```
+bool startTransmit(const uint8_t * data, size_t length, void * context) {...}
+
+TxQueue<1024> telemetry(startTransmit, &huart2);
+
+telemetry.print(TX_DROP, "Latitude is: %f\r\n", lat);
+
+void HAL_UART_TxCpltCallback(UART_HandleTypeDef * huart) { telemetry.complete(); }
+void HAL_UART_ErrorCallback(UART_HandleTypeDef * huart) { telemetry.abort(); }
+```
+ *
+ * @note Any context may write to the queue, but only one at a time. The transfers are started from
+ *       whichever of the writer and `complete` finds the queue idle.
+ */
+template <size_t capacity> class TxQueue
+{
+    public:
+    TxQueue(TransmitFunction transmit, void * context = NULL, TransmitClock clock = NULL, uint32_t timeout = TX_BLOCK_TIMEOUT);
+
+    size_t write(const uint8_t * data, size_t length, TxPolicy policy = TX_DROP);
+    size_t print(TxPolicy policy, const char * format, ...) __attribute__((__format__ (__printf__, 3, 4)));
+
+    void complete();
+    void abort();
+    bool isIdle();
+
+    TransmitStats getStats();
+
+    private:
+    SpscRing<uint8_t, capacity> ring;
+    TransmitFunction transmit;
+    void * context;
+    TransmitClock clock;
+    uint32_t timeout;
+
+    std::atomic<bool> busy{false};  // Whether a transfer is in progress
+    size_t inFlight = 0;            // The number of bytes in the transfer in progress
+
+    uint32_t nQueued = 0;
+    std::atomic<uint32_t> nSent{0};
+    uint32_t nDropped = 0;
+    uint32_t nBlocked = 0;
+    uint32_t nAbandoned = 0;
+    std::atomic<uint32_t> nErrors{0};
+
+    void start();
+};
+
+/* Include the template implementation after declaration
+ * NOTE: This is done as templates must either be fully defined in the header
+ *       or have specific implementations specified. To circumvent this, a file
+ *       with the template implementation can be included in the header to include
+ *       the implementation. This reduces the code in the header file.
+ * NOTE: Do NOT include transmit.tpp at the beginning of this file or at any point
+ *       in other header files.
+ * REFERENCE: https://stackoverflow.com/questions/495021/why-can-templates-only-be-implemented-in-the-header-file
+ * REFERENCE: https://isocpp.org/wiki/faq/templates#templates-defn-vs-decl
+ */
+#include "transmit.tpp"
+
+#endif
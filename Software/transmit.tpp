@@ -0,0 +1,212 @@
+/**
+ * FILE: transmit.tpp
+ * PURPOSE: To serve as the template implementation file for the transmit queue declared in transmit.hpp
+ *
+ * UPDATED: 17 Oct. 2026
+ *
+ * NOTE: Do NOT include this file other than at the end of transmit.hpp.
+ *       Any other includes may lead to issues.
+ */
+
+/* ------------------------ TxQueue Definitions ------------------------- */
+
+/**
+ * Creates an empty queue that transmits with the given function.
+ *
+ * @param transmit The function that starts each transfer.
+ * @param context The context passed to `transmit` (eg. the UART handle).
+ * @param clock The clock used to time out `TX_BLOCK` writes, or `NULL` to only stop waiting once no
+ *              transfer can be started.
+ * @param timeout The time, in the units of `clock`, that a `TX_BLOCK` write waits without any bytes
+ *                being queued.
+ */
+template <size_t capacity>
+TxQueue<capacity>::TxQueue(TransmitFunction transmit, void * context, TransmitClock clock, uint32_t timeout) :
+    transmit(transmit), context(context), clock(clock), timeout(timeout)
+{
+
+}
+
+/**
+ * Queues the given bytes to be transmitted, and starts transmitting them if no transfer is in progress.
+ *
+ * @param data The bytes to transmit.
+ * @param length The number of bytes.
+ * @param policy What to do if the bytes do not fit in the queue - either drop all of them, or wait for
+ *               the queue to be transmitted until they do.
+ *
+ * @returns The number of bytes that were queued, which is 0 if the message was dropped, or less than
+ *          `length` if the queue stopped transmitting whilst waiting.
+ *
+ * @note A message longer than the capacity is always dropped with `TX_DROP`, whereas `TX_BLOCK` queues it
+ *       as space becomes free. `TX_BLOCK` stops waiting if no transfer can be started to free the space,
+ *       or if no space is freed within the timeout, so the message is then only partly queued.
+ */
+template <size_t capacity>
+size_t TxQueue<capacity>::write(const uint8_t * data, size_t length, TxPolicy policy)
+{
+    size_t written = 0;
+    size_t queued;
+    uint32_t since = this->clock != NULL ? this->clock() : 0;
+
+    if (policy == TX_DROP && length > this->ring.getSpace())
+    {
+        this->nDropped++;
+        return 0;
+    }
+
+    if (length > this->ring.getSpace())
+    {
+        this->nBlocked++;
+    }
+
+    while (written < length)
+    {
+        queued = this->ring.write(data + written, length - written);
+        written += queued;
+
+        /* Once the queue is full, this waits for the transfer in progress to free some space */
+        this->start();
+
+        if (queued > 0 && this->clock != NULL)
+        {
+            since = this->clock();
+        }
+
+        if (written < length && queued == 0 && (!this->busy.load(std::memory_order_acquire)
+                || (this->clock != NULL && this->clock() - since >= this->timeout)))
+        {
+            this->nAbandoned++;
+            break;
+        }
+    }
+
+    this->nQueued += written;
+
+    return written;
+}
+
+/**
+ * Formats a message like `printf` and queues it to be transmitted (see `write`).
+ *
+ * @returns The number of bytes that were queued, which is 0 if the message was dropped.
+ *
+ * @note Messages are cut to `TX_MAX_PRINT_LENGTH` characters.
+ */
+template <size_t capacity>
+size_t TxQueue<capacity>::print(TxPolicy policy, const char * format, ...)
+{
+    char message[TX_MAX_PRINT_LENGTH + 1];
+    va_list args;
+    int length;
+
+    va_start(args, format);
+    length = vsnprintf(message, sizeof(message), format, args);
+    va_end(args);
+
+    if (length < 0)
+    {
+        return 0;
+    }
+
+    return this->write((const uint8_t *) message, (size_t) length < TX_MAX_PRINT_LENGTH ? length : TX_MAX_PRINT_LENGTH, policy);
+}
+
+/**
+ * Marks the transfer in progress as complete and starts transmitting the next bytes in the queue. This
+ * must be called once each transfer is complete (eg. from `HAL_UART_TxCpltCallback`).
+ */
+template <size_t capacity>
+void TxQueue<capacity>::complete()
+{
+    this->ring.commitRead(this->inFlight);
+    this->nSent.fetch_add((uint32_t) this->inFlight, std::memory_order_relaxed);
+    this->inFlight = 0;
+
+    this->busy.store(false, std::memory_order_release);
+
+    this->start();
+}
+
+/**
+ * Abandons the transfer in progress, as it has failed, and starts transmitting the next bytes in the
+ * queue. The bytes of the failed transfer are not sent again, as some of them may already have been sent.
+ * This must be called if a transfer will never complete (eg. from `HAL_UART_ErrorCallback` after a
+ * transmit DMA error), otherwise the queue stops transmitting.
+ */
+template <size_t capacity>
+void TxQueue<capacity>::abort()
+{
+    if (!this->busy.load(std::memory_order_acquire))
+    {
+        return;
+    }
+
+    this->ring.commitRead(this->inFlight);
+    this->inFlight = 0;
+    this->nErrors.fetch_add(1, std::memory_order_relaxed);
+
+    this->busy.store(false, std::memory_order_release);
+
+    this->start();
+}
+
+/* Returns whether every queued byte has been transmitted */
+template <size_t capacity>
+bool TxQueue<capacity>::isIdle()
+{
+    return !this->busy.load(std::memory_order_acquire) && this->ring.getSize() == 0;
+}
+
+/* Returns the counters of the queue (see `TransmitStats`) */
+template <size_t capacity>
+TransmitStats TxQueue<capacity>::getStats()
+{
+    TransmitStats stats = {};
+
+    stats.bytesQueued = this->nQueued;
+    stats.bytesSent = this->nSent.load(std::memory_order_relaxed);
+    stats.messagesDropped = this->nDropped;
+    stats.messagesBlocked = this->nBlocked;
+    stats.messagesAbandoned = this->nAbandoned;
+    stats.transferErrors = this->nErrors.load(std::memory_order_relaxed);
+    stats.peakFill = this->ring.getPeak();
+
+    return stats;
+}
+
+/**
+ * Starts transmitting the next contiguous section of the queue, unless a transfer is already in progress
+ * or the queue is empty. Whoever claims `busy` is the only consumer of the ring until the transfer is
+ * complete.
+ */
+template <size_t capacity>
+void TxQueue<capacity>::start()
+{
+    bool idle = false;
+
+    if (!this->busy.compare_exchange_strong(idle, true, std::memory_order_acq_rel))
+    {
+        return;
+    }
+
+    RingSegment<const uint8_t> segment = this->ring.getReadSegment();
+
+    if (segment.length == 0)
+    {
+        this->busy.store(false, std::memory_order_release);
+        return;
+    }
+
+    /* The transfer may complete before `transmit` returns, so its length is recorded first */
+    this->inFlight = segment.length;
+
+    if (!this->transmit(segment.data, segment.length, this->context))
+    {
+        this->inFlight = 0;
+        this->nErrors.fetch_add(1, std::memory_order_relaxed);
+        this->busy.store(false, std::memory_order_release);
+    }
+}
+
+/* ---------------------- End TxQueue Definitions ----------------------- */
@@ -53,7 +53,7 @@ namespace UBX_DTYPES
 
     uint16_t convertU2(const uint8_t * const littleEndian)
     {
-        return littleEndian[1] | ((uint16_t) littleEndian[0] << 8);
+        return littleEndian[0] | ((uint16_t) littleEndian[1] << 8);
     };
 
     uint16_t convertU2(const uint16_t littleEndian)
@@ -342,25 +342,63 @@ bool UBX::getValidity()
     return this->valid;
 }
 
-// Currently assumes that a message is present (ie. there exists 0xb5 and 0x62)
-// Also assumes that the message is complete and the memory is accessible throughout the message
-void UBX::readUBX(const uint8_t * const message)
+/**
+ * Reads the first message in the given bytes. The payload is not copied, so `payload` points into the given
+ * bytes.
+ *
+ * @param message The bytes to read the message from, which may start before the sync characters.
+ * @param length The number of bytes.
+ *
+ * @note The message is only valid (see `getValidity`) if it is complete within the given bytes, it is of
+ *       the same class and id as this message (unless this is a plain `UBX`) and its checksum matches. The
+ *       payload is only read if the message is valid.
+ */
+void UBX::readUBX(const uint8_t * const message, uint16_t length)
 {
-    char preamble[3] = {0xb5, 0x62, '\0'};
+    const uint8_t * const end = message + length;
+    const uint8_t * msg = (const uint8_t *) memchr(message, 0xb5, length);
 
-    uint8_t * msg = (uint8_t *) strstr((const char * const) message, preamble);
+    this->valid = false;
+
+    // Unlike strstr, memchr does not stop at the 0x00 bytes that are common in the payload
+    while (msg != NULL && end - msg >= 2 && msg[1] != 0x62)
+    {
+        msg = (const uint8_t *) memchr(msg + 1, 0xb5, end - msg - 1);
+    }
+
+    // The header (sync characters, class, id and length) and the checksum must be within the bytes
+    if (msg == NULL || end - msg < 8)
+    {
+        return;
+    }
 
     this->clazz = msg[2];
     this->id = msg[3];
     this->length = (uint16_t) msg[5] << 8 | (uint16_t) msg[4];
+
+    // A message of a known type (ie. any sub-class) can only be read from a message of the same type
+    if (this->getClass() != 0x00 && (this->clazz != this->getClass() || this->id != this->getID()))
+    {
+        return;
+    }
+
+    // The length is only trusted once it is known that the whole payload is within the bytes
+    if (end - msg - 8 < this->length)
+    {
+        return;
+    }
+
     this->payload = msg + 6;
     this->checksum[0] = msg[this->length + 6];
     this->checksum[1] = msg[this->length + 7];
 
     // Verify if the calculated checksum and the given checksum are the same.
-    this->valid = UBX::checkChecksum(message + 2, 4 + this->length, this->checksum[0], this->checksum[1]);
+    this->valid = UBX::checkChecksum(msg + 2, 4 + this->length, this->checksum[0], this->checksum[1]);
 
-    this->readPayload(this->payload);
+    if (this->valid)
+    {
+        this->readPayload(this->payload);
+    }
 }
 
 /** 
@@ -427,13 +465,13 @@ bool UBX::checkChecksum(const uint8_t * const checksumRegion, uint16_t length, u
 {
     uint16_t check = UBX::ubxChecksum(checksumRegion, length);
 
-    return check == (uint16_t) CK_A << 8 | CK_B;
+    return check == (((uint16_t) CK_A << 8) | CK_B);
 }
 
 CFG_VALGET::CFG_VALGET(CFG::LAYER layer, uint16_t position, std::vector<CFG::KEYS> keys)
 {
     this->layer = layer;
-    this->position = UBX_DTYPES::convertU2(position);
+    this->position = position;
     this->keys = keys;
 }
 
@@ -447,6 +485,17 @@ void CFG_VALGET::readPayload(const uint8_t * const payload)
     
     // uint16_t nKeys = (this->length - 4) / 4;
 
+    if (this->length < 4)
+    {
+        return;
+    }
+
+    // A message may be read more than once, eg. whilst waiting for the expected response
+    if (this->cfgData != NULL)
+    {
+        delete this->cfgData;
+    }
+
     this->cfgData = new CFGData((uint8_t *) payload + 4, this->length - 4);
 }
 
@@ -562,4 +611,746 @@ void ACK::UBX_ACK::readPayload(const uint8_t * const payload)
 
 ACK::ACK::ACK(uint8_t clsID, uint8_t msgID) : ACK::UBX_ACK(clsID, msgID){}
 
-ACK::NAK::NAK(uint8_t clsID, uint8_t msgID) : ACK::UBX_ACK(clsID, msgID){}
\ No newline at end of file
+ACK::NAK::NAK(uint8_t clsID, uint8_t msgID) : ACK::UBX_ACK(clsID, msgID){}
+
+/**
+ * Writes the given UTC time as the "hhmmss.ss" string of the `TIME` group, to the hundredth of a second as
+ * in the NMEA sentences. A negative fraction only rounds the time up by less than a hundredth.
+ */
+static std::string formatTime(uint8_t hour, uint8_t minute, uint8_t second, int32_t nano)
+{
+    char time[16];
+
+    snprintf(time, sizeof(time), "%02u%02u%02u.%02lu", hour, minute, second,
+            (unsigned long) (nano > 0 ? nano / 10000000 : 0));
+
+    return std::string(time);
+}
+
+
+NAV_PVT::NAV_PVT(){}
+
+/**
+ * Decodes the fields of the `POS3D` and `TIME` groups from the payload, so that the message can be
+ * consumed as either group. Every other field is decoded in place by its getter.
+ */
+void NAV_PVT::readPayload(const uint8_t * const payload)
+{
+    // The payload length is fixed, so anything else is not a NAV-PVT message that can be read
+    if (this->length != NAV_PVT_LENGTH)
+    {
+        this->valid = false;
+        return;
+    }
+
+    int32_t lon = (int32_t) UBX_DTYPES::convertU4(payload + 24);
+    int32_t lat = (int32_t) UBX_DTYPES::convertU4(payload + 28);
+    bool fixOK = this->getFixOK();
+    bool fix3D = fixOK && (this->getFixType() == 3 || this->getFixType() == 4);
+    bool timeValid = (this->getValidFlags() & 0x02) != 0;
+
+    // The group stores the coordinates unsigned, with the hemisphere separately (as the NMEA sentences do)
+    this->lat.setValue(lat < 0 ? -lat : lat, fixOK);
+    this->NS.setValue(lat < 0 ? 'S' : 'N', fixOK);
+    this->lon.setValue(lon < 0 ? -lon : lon, fixOK);
+    this->EW.setValue(lon < 0 ? 'W' : 'E', fixOK);
+    this->alt.setValue(this->getHeightMSL() / 1000.0f, fix3D);
+
+    this->time.setValue(formatTime(this->getHour(), this->getMinute(), this->getSecond(), this->getNano()),
+            timeValid);
+}
+
+uint32_t NAV_PVT::getITOW()
+{
+    return UBX_DTYPES::convertU4(this->payload);
+}
+
+uint16_t NAV_PVT::getYear()
+{
+    return UBX_DTYPES::convertU2(this->payload + 4);
+}
+
+uint8_t NAV_PVT::getMonth()
+{
+    return this->payload[6];
+}
+
+uint8_t NAV_PVT::getDay()
+{
+    return this->payload[7];
+}
+
+uint8_t NAV_PVT::getHour()
+{
+    return this->payload[8];
+}
+
+uint8_t NAV_PVT::getMinute()
+{
+    return this->payload[9];
+}
+
+uint8_t NAV_PVT::getSecond()
+{
+    return this->payload[10];
+}
+
+uint8_t NAV_PVT::getValidFlags()
+{
+    return this->payload[11];
+}
+
+uint32_t NAV_PVT::getTimeAccuracy()
+{
+    return UBX_DTYPES::convertU4(this->payload + 12);
+}
+
+int32_t NAV_PVT::getNano()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 16);
+}
+
+uint8_t NAV_PVT::getFixType()
+{
+    return this->payload[20];
+}
+
+uint8_t NAV_PVT::getFixFlags()
+{
+    return this->payload[21];
+}
+
+// Returns whether the fix is valid (ie. within the DOP and accuracy masks)
+bool NAV_PVT::getFixOK()
+{
+    return (this->getFixFlags() & 0x01) != 0;
+}
+
+uint8_t NAV_PVT::getNumSV()
+{
+    return this->payload[23];
+}
+
+int32_t NAV_PVT::getHeight()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 32);
+}
+
+int32_t NAV_PVT::getHeightMSL()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 36);
+}
+
+uint32_t NAV_PVT::getHorizontalAccuracy()
+{
+    return UBX_DTYPES::convertU4(this->payload + 40);
+}
+
+uint32_t NAV_PVT::getVerticalAccuracy()
+{
+    return UBX_DTYPES::convertU4(this->payload + 44);
+}
+
+int32_t NAV_PVT::getVelocityN()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 48);
+}
+
+int32_t NAV_PVT::getVelocityE()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 52);
+}
+
+int32_t NAV_PVT::getVelocityD()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 56);
+}
+
+int32_t NAV_PVT::getGroundSpeed()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 60);
+}
+
+int32_t NAV_PVT::getHeadingOfMotion()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 64);
+}
+
+uint32_t NAV_PVT::getSpeedAccuracy()
+{
+    return UBX_DTYPES::convertU4(this->payload + 68);
+}
+
+uint32_t NAV_PVT::getHeadingAccuracy()
+{
+    return UBX_DTYPES::convertU4(this->payload + 72);
+}
+
+uint16_t NAV_PVT::getPDOP()
+{
+    return UBX_DTYPES::convertU2(this->payload + 76);
+}
+
+
+NAV_DOP::NAV_DOP(){}
+
+void NAV_DOP::readPayload(const uint8_t * const)
+{
+    // The payload length is fixed, so anything else is not a NAV-DOP message that can be read
+    if (this->length != NAV_DOP_LENGTH)
+    {
+        this->valid = false;
+    }
+}
+
+uint32_t NAV_DOP::getITOW()
+{
+    return UBX_DTYPES::convertU4(this->payload);
+}
+
+uint16_t NAV_DOP::getGDOP()
+{
+    return UBX_DTYPES::convertU2(this->payload + 4);
+}
+
+uint16_t NAV_DOP::getPDOP()
+{
+    return UBX_DTYPES::convertU2(this->payload + 6);
+}
+
+uint16_t NAV_DOP::getTDOP()
+{
+    return UBX_DTYPES::convertU2(this->payload + 8);
+}
+
+uint16_t NAV_DOP::getVDOP()
+{
+    return UBX_DTYPES::convertU2(this->payload + 10);
+}
+
+uint16_t NAV_DOP::getHDOP()
+{
+    return UBX_DTYPES::convertU2(this->payload + 12);
+}
+
+uint16_t NAV_DOP::getNDOP()
+{
+    return UBX_DTYPES::convertU2(this->payload + 14);
+}
+
+uint16_t NAV_DOP::getEDOP()
+{
+    return UBX_DTYPES::convertU2(this->payload + 16);
+}
+
+
+NAV_STATUS::NAV_STATUS(){}
+
+void NAV_STATUS::readPayload(const uint8_t * const)
+{
+    // The payload length is fixed, so anything else is not a NAV-STATUS message that can be read
+    if (this->length != NAV_STATUS_LENGTH)
+    {
+        this->valid = false;
+    }
+}
+
+uint32_t NAV_STATUS::getITOW()
+{
+    return UBX_DTYPES::convertU4(this->payload);
+}
+
+uint8_t NAV_STATUS::getFixType()
+{
+    return this->payload[4];
+}
+
+uint8_t NAV_STATUS::getFlags()
+{
+    return this->payload[5];
+}
+
+// Returns whether the fix is valid (ie. within the DOP and accuracy masks)
+bool NAV_STATUS::getFixOK()
+{
+    return (this->getFlags() & 0x01) != 0;
+}
+
+uint8_t NAV_STATUS::getFixStatus()
+{
+    return this->payload[6];
+}
+
+uint8_t NAV_STATUS::getFlags2()
+{
+    return this->payload[7];
+}
+
+uint32_t NAV_STATUS::getTTFF()
+{
+    return UBX_DTYPES::convertU4(this->payload + 8);
+}
+
+uint32_t NAV_STATUS::getMSSS()
+{
+    return UBX_DTYPES::convertU4(this->payload + 12);
+}
+
+
+NAV_TIMEUTC::NAV_TIMEUTC(){}
+
+/**
+ * Decodes the field of the `TIME` group from the payload, so that the message can be consumed as the
+ * group. Every other field is decoded in place by its getter.
+ */
+void NAV_TIMEUTC::readPayload(const uint8_t * const)
+{
+    // The payload length is fixed, so anything else is not a NAV-TIMEUTC message that can be read
+    if (this->length != NAV_TIMEUTC_LENGTH)
+    {
+        this->valid = false;
+        return;
+    }
+
+    this->time.setValue(formatTime(this->getHour(), this->getMinute(), this->getSecond(), this->getNano()),
+            this->getValidUTC());
+}
+
+uint32_t NAV_TIMEUTC::getITOW()
+{
+    return UBX_DTYPES::convertU4(this->payload);
+}
+
+uint32_t NAV_TIMEUTC::getTimeAccuracy()
+{
+    return UBX_DTYPES::convertU4(this->payload + 4);
+}
+
+int32_t NAV_TIMEUTC::getNano()
+{
+    return (int32_t) UBX_DTYPES::convertU4(this->payload + 8);
+}
+
+uint16_t NAV_TIMEUTC::getYear()
+{
+    return UBX_DTYPES::convertU2(this->payload + 12);
+}
+
+uint8_t NAV_TIMEUTC::getMonth()
+{
+    return this->payload[14];
+}
+
+uint8_t NAV_TIMEUTC::getDay()
+{
+    return this->payload[15];
+}
+
+uint8_t NAV_TIMEUTC::getHour()
+{
+    return this->payload[16];
+}
+
+uint8_t NAV_TIMEUTC::getMinute()
+{
+    return this->payload[17];
+}
+
+uint8_t NAV_TIMEUTC::getSecond()
+{
+    return this->payload[18];
+}
+
+uint8_t NAV_TIMEUTC::getValidFlags()
+{
+    return this->payload[19];
+}
+
+// Returns whether the UTC time is valid (ie. the leap seconds are known)
+bool NAV_TIMEUTC::getValidUTC()
+{
+    return (this->getValidFlags() & 0x04) != 0;
+}
+
+
+SatelliteTable::SatelliteTable(){}
+
+/**
+ * Empties every row of the table, before the satellites of the given epoch are added.
+ *
+ * @param iTOW The GPS time of week (ms) of the epoch that the table is to hold.
+ */
+void SatelliteTable::clear(uint32_t iTOW)
+{
+    memset(this->lengths, 0, sizeof(this->lengths));
+
+    this->epoch = iTOW;
+    this->hasEpoch = true;
+}
+
+/* Returns whether the table holds the epoch with the given GPS time of week (ms) */
+bool SatelliteTable::isEpoch(uint32_t iTOW)
+{
+    return this->hasEpoch && this->epoch == iTOW;
+}
+
+/**
+ * Finds the given satellite in the row of its constellation.
+ *
+ * @param gnssId The GNSS identifier of the satellite.
+ * @param svId The identifier of the satellite within its constellation.
+ * @param insert Whether to add the satellite to the table if it is not already in it.
+ *
+ * @returns The satellite, or NULL if it is not in the table (and was not inserted, as it was not asked to
+ *          be or as its row is full).
+ */
+SatInfo * const SatelliteTable::find(uint8_t gnssId, uint8_t svId, bool insert)
+{
+    uint8_t i;
+
+    if (gnssId >= UBX_GNSS_COUNT)
+    {
+        return NULL;
+    }
+
+    SatInfo * row = this->satellites[gnssId];
+
+    for (i = 0; i < this->lengths[gnssId]; i++)
+    {
+        if (row[i].data.svid == svId)
+        {
+            return &row[i];
+        }
+    }
+
+    if (!insert)
+    {
+        return NULL;
+    }
+
+    if (this->lengths[gnssId] >= SATELLITE_TABLE_SIZE)
+    {
+        this->nDropped++;
+        return NULL;
+    }
+
+    SatInfo * satellite = &row[this->lengths[gnssId]++];
+
+    *satellite = {};
+    satellite->data.svid = svId;
+    satellite->gnssId = gnssId;
+
+    return satellite;
+}
+
+/**
+ * Updates the table from the given message if it is a NAV-SAT or NAV-SIG message.
+ *
+ * @param message The complete message, from the sync characters to the checksum.
+ * @param length The number of bytes in the message.
+ *
+ * @returns `true` if the message was a valid NAV-SAT or NAV-SIG message, otherwise `false`.
+ */
+bool SatelliteTable::read(const uint8_t * const message, uint16_t length)
+{
+    if (length < 8)
+    {
+        return false;
+    }
+
+    switch ((uint16_t) message[2] << 8 | message[3])
+    {
+        case 0x0135:
+        {
+            NAV_SAT sat;
+
+            sat.readUBX(message, length);
+
+            if (sat.getValidity())
+            {
+                sat.update(*this);
+            }
+
+            return sat.getValidity();
+        }
+
+        case 0x0143:
+        {
+            NAV_SIG sig;
+
+            sig.readUBX(message, length);
+
+            if (sig.getValidity())
+            {
+                sig.update(*this);
+            }
+
+            return sig.getValidity();
+        }
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * Returns the row of the given constellation.
+ *
+ * @param gnssId The GNSS identifier of the constellation.
+ * @param arrLength Set to the number of satellites in the row.
+ */
+const SatInfo * const SatelliteTable::getSatellites(uint8_t gnssId, uint8_t * const arrLength)
+{
+    *arrLength = gnssId < UBX_GNSS_COUNT ? this->lengths[gnssId] : 0;
+
+    return gnssId < UBX_GNSS_COUNT ? this->satellites[gnssId] : NULL;
+}
+
+uint16_t SatelliteTable::getNumSatellites()
+{
+    uint16_t n = 0;
+    uint8_t i;
+
+    for (i = 0; i < UBX_GNSS_COUNT; i++)
+    {
+        n += this->lengths[i];
+    }
+
+    return n;
+}
+
+// Returns the number of satellites that are used in the navigation solution, by either message
+uint16_t SatelliteTable::getNumUsed()
+{
+    uint16_t n = 0;
+    uint8_t i, j;
+
+    for (i = 0; i < UBX_GNSS_COUNT; i++)
+    {
+        for (j = 0; j < this->lengths[i]; j++)
+        {
+            n += this->satellites[i][j].used != 0;
+        }
+    }
+
+    return n;
+}
+
+uint32_t SatelliteTable::getEpoch()
+{
+    return this->epoch;
+}
+
+uint32_t SatelliteTable::getDropped()
+{
+    return this->nDropped;
+}
+
+
+NAV_SAT::NAV_SAT(){}
+
+void NAV_SAT::readPayload(const uint8_t * const)
+{
+    // Each satellite takes 12 bytes after the 8 byte header, so the length must match the count exactly
+    if (this->length < 8 || this->length != 8 + 12 * this->getNumSvs())
+    {
+        this->valid = false;
+    }
+}
+
+uint32_t NAV_SAT::getITOW()
+{
+    return UBX_DTYPES::convertU4(this->payload);
+}
+
+uint8_t NAV_SAT::getNumSvs()
+{
+    return this->payload[5];
+}
+
+/**
+ * Decodes the satellite at the given index (which must be less than `getNumSvs`) from the payload.
+ */
+SatInfo NAV_SAT::getSatellite(uint8_t index)
+{
+    const uint8_t * const sv = this->payload + 8 + 12 * index;
+    uint32_t flags = UBX_DTYPES::convertU4(sv + 8);
+    SatInfo satellite = {};
+
+    satellite.gnssId = sv[0];
+    satellite.data.svid = sv[1];
+    satellite.data.cno = sv[2];
+    satellite.data.elv = (int8_t) sv[3] > 0 ? sv[3] : 0;
+    satellite.data.az = (uint16_t) UBX_DTYPES::convertU2(sv + 4);
+    satellite.quality = flags & 0x07;
+    satellite.used = (flags & (1 << 3)) != 0 ? SAT_USED_NAV : 0;
+    satellite.health = (flags >> 4) & 0x03;
+
+    return satellite;
+}
+
+/**
+ * Replaces the contents of the table with the satellites in this message, in a single pass.
+ */
+void NAV_SAT::update(SatelliteTable& table)
+{
+    uint8_t i;
+
+    table.clear(this->getITOW());
+
+    for (i = 0; i < this->getNumSvs(); i++)
+    {
+        SatInfo satellite = this->getSatellite(i);
+        SatInfo * const entry = table.find(satellite.gnssId, satellite.data.svid, true);
+
+        if (entry != NULL)
+        {
+            *entry = satellite;
+        }
+    }
+}
+
+
+NAV_SIG::NAV_SIG(){}
+
+void NAV_SIG::readPayload(const uint8_t * const)
+{
+    // Each signal takes 16 bytes after the 8 byte header, so the length must match the count exactly
+    if (this->length < 8 || this->length != 8 + 16 * this->getNumSigs())
+    {
+        this->valid = false;
+    }
+}
+
+uint32_t NAV_SIG::getITOW()
+{
+    return UBX_DTYPES::convertU4(this->payload);
+}
+
+uint8_t NAV_SIG::getNumSigs()
+{
+    return this->payload[5];
+}
+
+/**
+ * Merges the signals in this message into the satellites of the table, in a single pass. Each satellite
+ * takes the strongest C/N0 and best quality of its signals, is unhealthy if any of its signals is, and is
+ * marked with the ranges that are used from any of its signals. A satellite that is not yet in the table
+ * (eg. as no NAV-SAT message has been received) is added without a position.
+ *
+ * @note If the table holds a different epoch (eg. as NAV-SAT is not output, or its message was lost), it
+ *       is emptied first, so the signals of past epochs never pile up.
+ */
+void NAV_SIG::update(SatelliteTable& table)
+{
+    uint8_t i;
+
+    if (!table.isEpoch(this->getITOW()))
+    {
+        table.clear(this->getITOW());
+    }
+
+    for (i = 0; i < this->getNumSigs(); i++)
+    {
+        const uint8_t * const sig = this->payload + 8 + 16 * i;
+        uint16_t flags = UBX_DTYPES::convertU2(sig + 10);
+        uint8_t health = flags & 0x03;
+        SatInfo * const satellite = table.find(sig[0], sig[1], true);
+
+        if (satellite == NULL)
+        {
+            continue;
+        }
+
+        satellite->data.cno = sig[6] > satellite->data.cno ? sig[6] : satellite->data.cno;
+        satellite->quality = sig[7] > satellite->quality ? sig[7] : satellite->quality;
+        satellite->health = health == 2 || satellite->health == 2 ? 2 : (health > satellite->health ? health : satellite->health);
+
+        // The pseudorange, carrier range and range rate used flags are bits 3 to 5
+        satellite->used |= (flags >> 2) & (SAT_USED_PR | SAT_USED_CR | SAT_USED_DO);
+    }
+}
+
+
+/**
+ * Classifies and reads the message in the given frame. If the frame is not a message type that can be
+ * parsed, or it is not a valid message, the type is `UBX_INV`.
+ *
+ * @param message The complete frame, from the sync characters to the checksum.
+ * @param length The number of bytes in the frame.
+ */
+ParsedMessage::ParsedMessage(const uint8_t * const message, uint16_t length)
+{
+    if (length < 8 || message[0] != 0xb5 || message[1] != 0x62)
+    {
+        return;
+    }
+
+    switch (ParsedMessage::classify(message[2], message[3]))
+    {
+        case UBX_NAV_PVT:
+            this->message = &this->storage.emplace<NAV_PVT>();
+            break;
+
+        case UBX_NAV_DOP:
+            this->message = &this->storage.emplace<NAV_DOP>();
+            break;
+
+        case UBX_NAV_STATUS:
+            this->message = &this->storage.emplace<NAV_STATUS>();
+            break;
+
+        case UBX_NAV_TIMEUTC:
+            this->message = &this->storage.emplace<NAV_TIMEUTC>();
+            break;
+
+        default:
+            return;
+    }
+
+    this->message->readUBX(message, length);
+
+    if (this->message->getValidity())
+    {
+        this->type = ParsedMessage::classify(message[2], message[3]);
+    }
+    else
+    {
+        this->storage.emplace<std::monostate>();
+        this->message = NULL;
+    }
+}
+
+Messages ParsedMessage::getType()
+{
+    return this->type;
+}
+
+UBX * const ParsedMessage::getMessage()
+{
+    return this->message;
+}
+
+/**
+ * Returns the type of message with the given class and id, or `UBX_INV` if it cannot be parsed.
+ */
+Messages ParsedMessage::classify(uint8_t clazz, uint8_t id)
+{
+    switch ((uint16_t) clazz << 8 | id)
+    {
+        case 0x0107:
+            return UBX_NAV_PVT;
+
+        case 0x0104:
+            return UBX_NAV_DOP;
+
+        case 0x0103:
+            return UBX_NAV_STATUS;
+
+        case 0x0121:
+            return UBX_NAV_TIMEUTC;
+
+        default:
+            return UBX_INV;
+    }
+}
@@ -4,13 +4,37 @@
 #include <string.h>
 #include <stdint.h>
 #include <vector>
+#include <variant>
+#include <type_traits>
+
+#include "sentences.hpp"
+
+/* The lengths of the fixed-length UBX-NAV payloads */
+#define NAV_PVT_LENGTH 92
+#define NAV_DOP_LENGTH 18
+#define NAV_STATUS_LENGTH 16
+#define NAV_TIMEUTC_LENGTH 20
+
+/* The number of GNSS identifiers used by UBX messages (0 GPS, 1 SBAS, 2 Galileo, 3 BeiDou, 4 IMES, 5 QZSS,
+ * 6 GLONASS, 7 NavIC) and the number of satellites that are kept for each */
+#define UBX_GNSS_COUNT 8
+#define SATELLITE_TABLE_SIZE 24
 
 namespace CFG
 {
     enum KEYS : uint32_t
     {
         // --------------- NAVSPG ---------------
-        NAVSPG_DYNMODEL = 0x20110021
+        NAVSPG_DYNMODEL = 0x20110021,
+        // --------------------------------------
+
+        // --------------- MSGOUT ---------------
+        MSGOUT_UBX_NAV_PVT_UART1 = 0x20910007,
+        MSGOUT_UBX_NAV_SAT_UART1 = 0x20910016,
+        MSGOUT_UBX_NAV_SIG_UART1 = 0x20910346,
+        MSGOUT_UBX_NAV_DOP_UART1 = 0x20910039,
+        MSGOUT_UBX_NAV_STATUS_UART1 = 0x2091001b,
+        MSGOUT_UBX_NAV_TIMEUTC_UART1 = 0x2091005c
         // --------------------------------------
     };
 
@@ -123,10 +147,11 @@ class UBX
     uint8_t clazz;
     uint8_t id;
     uint16_t length;
-    uint8_t * payload;  // May change to std::vector later
+    const uint8_t * payload;    // Points into the message that was read, so it is only valid as long as the message is
     uint8_t checksum[2];
 
     public:
+    static constexpr SentenceMask acceptedTypes = 0;    // A message is not parsed from any NMEA sentence
     virtual uint8_t getClass() {return 0x00;}
     virtual uint8_t getID() {return 0x00;}
 
@@ -137,7 +162,7 @@ class UBX
     public:
     bool getValidity();
 
-    virtual void readUBX(const uint8_t * const message);
+    virtual void readUBX(const uint8_t * const message, uint16_t length);
     virtual std::vector<uint8_t> getUBX();
     static uint16_t ubxChecksum(const uint8_t * const checksumRegion, uint16_t length);
     static bool checkChecksum(const uint8_t * const checksumRegion, uint16_t length, uint8_t CK_A, uint8_t CK_B);
@@ -228,4 +253,313 @@ namespace ACK
 }
 
 
+/**
+ * The UBX message types that can be parsed from the received stream by `ParsedMessage`.
+ */
+enum Messages
+{
+    UBX_INV,
+    UBX_NAV_PVT,
+    UBX_NAV_DOP,
+    UBX_NAV_STATUS,
+    UBX_NAV_TIMEUTC
+};
+
+/**
+ * The class for the navigation position velocity time solution (UBX-NAV-PVT). A single message carries the
+ * fix that is otherwise spread over `GGA`, `RMC`, `GSA` and `VTG`, as little-endian binary fields.
+ *
+ * The message is a view of the bytes it was read from - each getter decodes its field from the payload in
+ * place, so the bytes must stay valid for as long as the message is used. Only the fields of the `POS3D`
+ * and `TIME` groups are decoded when the message is read, so that the message reaches the same consumers
+ * as the NMEA sentences (eg. a consumer subscribed to `POS`).
+ */
+class NAV_PVT : public UBX, public POS3D, public TIME
+{
+    public:
+    NAV_PVT();
+
+    public:
+    static constexpr SentenceMask acceptedTypes = 0;
+    uint8_t getClass() override {return 0x01;}
+    uint8_t getID() override {return 0x07;}
+
+    protected:
+    void readPayload(const uint8_t * const payload) override;
+
+    public:
+    uint32_t getITOW();             // ms, GPS time of week of the navigation epoch
+    uint16_t getYear();
+    uint8_t getMonth();
+    uint8_t getDay();
+    uint8_t getHour();
+    uint8_t getMinute();
+    uint8_t getSecond();
+    uint8_t getValidFlags();        // validDate (bit 0), validTime (bit 1), fullyResolved (bit 2), validMag (bit 3)
+    uint32_t getTimeAccuracy();     // ns
+    int32_t getNano();              // ns, fraction of the second (may be negative)
+    uint8_t getFixType();           // 0 no fix, 1 dead reckoning, 2 2D, 3 3D, 4 GNSS + dead reckoning, 5 time only
+    uint8_t getFixFlags();          // gnssFixOK (bit 0), diffSoln (bit 1), carrSoln (bits 6..7)
+    bool getFixOK();
+    uint8_t getNumSV();
+    int32_t getHeight();            // mm, above the ellipsoid
+    int32_t getHeightMSL();         // mm, above mean sea level
+    uint32_t getHorizontalAccuracy();   // mm
+    uint32_t getVerticalAccuracy();     // mm
+    int32_t getVelocityN();         // mm/s
+    int32_t getVelocityE();         // mm/s
+    int32_t getVelocityD();         // mm/s
+    int32_t getGroundSpeed();       // mm/s
+    int32_t getHeadingOfMotion();   // 1e-5 degrees
+    uint32_t getSpeedAccuracy();    // mm/s
+    uint32_t getHeadingAccuracy();  // 1e-5 degrees
+    uint16_t getPDOP();             // 0.01
+};
+
+/* How a satellite is used, as flags in `SatInfo::used` */
+enum SatUsed : uint8_t
+{
+    SAT_USED_NAV = 1 << 0,  // Used in the navigation solution
+    SAT_USED_PR = 1 << 1,   // A pseudorange of one of its signals is used
+    SAT_USED_CR = 1 << 2,   // A carrier range of one of its signals is used
+    SAT_USED_DO = 1 << 3    // A range rate (Doppler) of one of its signals is used
+};
+
+/**
+ * The state of a single satellite in the sky view. The position and signal strength use the same layout as
+ * a `GSV` satellite (`SatData`), so the same consumers can use either.
+ */
+struct SatInfo
+{
+    SatData data;       // The svid, elevation (deg, negative elevations are 0), azimuth (deg) and C/N0 (dBHz)
+    uint8_t gnssId;     // The GNSS identifier (see `UBX_GNSS_COUNT`)
+    uint8_t quality;    // The signal quality indicator (0 no signal to 7 code and carrier locked)
+    uint8_t health;     // 0 unknown, 1 healthy, 2 unhealthy
+    uint8_t used;       // The `SatUsed` flags
+};
+
+/**
+ * A fixed-capacity table of the satellites in view, with a row for each constellation. The table is
+ * filled by UBX-NAV-SAT (the satellites in view, their position and whether they are used) and then
+ * refined by UBX-NAV-SIG (the health and use of each signal), each in a single pass over its message.
+ *
+ * The table only ever holds a single navigation epoch (its iTOW). A NAV-SIG message from any other epoch
+ * empties the table first, so if NAV-SIG is output on its own (or the NAV-SAT message of an epoch is
+ * lost), the table holds the satellites with tracked signals of the latest epoch, without their positions.
+ *
+ * For example:
+```
+SatelliteTable satellites;
+
+satellites.read(message, length);   // Any NAV-SAT or NAV-SIG message, in the order they are received
+
+uint8_t nGPS;
+const SatInfo * const gps = satellites.getSatellites(0, &nGPS);
+```
+ */
+class SatelliteTable
+{
+    public:
+    SatelliteTable();
+
+    void clear(uint32_t iTOW);
+    bool isEpoch(uint32_t iTOW);
+    SatInfo * const find(uint8_t gnssId, uint8_t svId, bool insert);
+    bool read(const uint8_t * const message, uint16_t length);
+
+    const SatInfo * const getSatellites(uint8_t gnssId, uint8_t * const arrLength);
+    uint16_t getNumSatellites();
+    uint16_t getNumUsed();
+    uint32_t getEpoch();
+    uint32_t getDropped();
+
+    private:
+    SatInfo satellites[UBX_GNSS_COUNT][SATELLITE_TABLE_SIZE];
+    uint8_t lengths[UBX_GNSS_COUNT] = {};
+    uint32_t epoch = 0;     // ms, the GPS time of week of the epoch that the table holds
+    bool hasEpoch = false;  // Whether the table holds any epoch, ie. whether `epoch` is set
+    uint32_t nDropped = 0;  // Satellites that did not fit in the row of their constellation
+};
+
+/**
+ * The class for the satellite information message (UBX-NAV-SAT), which lists every satellite in view in
+ * a single message (rather than up to 4 per `GSV` sentence, over several sentences per constellation).
+ * The satellites are decoded in place from the payload.
+ */
+class NAV_SAT : public UBX
+{
+    public:
+    NAV_SAT();
+
+    public:
+    uint8_t getClass() override {return 0x01;}
+    uint8_t getID() override {return 0x35;}
+
+    protected:
+    void readPayload(const uint8_t * const payload) override;
+
+    public:
+    uint32_t getITOW();     // ms, GPS time of week of the navigation epoch
+    uint8_t getNumSvs();
+    SatInfo getSatellite(uint8_t index);
+    void update(SatelliteTable& table);
+};
+
+/**
+ * The class for the signal information message (UBX-NAV-SIG), which lists every signal that is tracked,
+ * with up to one signal per frequency band for each satellite. The signals are decoded in place from the
+ * payload.
+ */
+class NAV_SIG : public UBX
+{
+    public:
+    NAV_SIG();
+
+    public:
+    uint8_t getClass() override {return 0x01;}
+    uint8_t getID() override {return 0x43;}
+
+    protected:
+    void readPayload(const uint8_t * const payload) override;
+
+    public:
+    uint32_t getITOW();     // ms, GPS time of week of the navigation epoch
+    uint8_t getNumSigs();
+    void update(SatelliteTable& table);
+};
+
+/**
+ * The class for the dilution of precision message (UBX-NAV-DOP). Every DOP is an integer in units of 0.01,
+ * decoded in place from the payload, so no precision is lost to text or floating point.
+ */
+class NAV_DOP : public UBX
+{
+    public:
+    NAV_DOP();
+
+    public:
+    uint8_t getClass() override {return 0x01;}
+    uint8_t getID() override {return 0x04;}
+
+    protected:
+    void readPayload(const uint8_t * const payload) override;
+
+    public:
+    uint32_t getITOW();     // ms, GPS time of week of the navigation epoch
+    uint16_t getGDOP();     // Geometric, 0.01
+    uint16_t getPDOP();     // Position, 0.01
+    uint16_t getTDOP();     // Time, 0.01
+    uint16_t getVDOP();     // Vertical, 0.01
+    uint16_t getHDOP();     // Horizontal, 0.01
+    uint16_t getNDOP();     // Northing, 0.01
+    uint16_t getEDOP();     // Easting, 0.01
+};
+
+/**
+ * The class for the receiver navigation status message (UBX-NAV-STATUS), which gives the time to first
+ * fix and the time since startup directly, decoded in place from the payload.
+ */
+class NAV_STATUS : public UBX
+{
+    public:
+    NAV_STATUS();
+
+    public:
+    uint8_t getClass() override {return 0x01;}
+    uint8_t getID() override {return 0x03;}
+
+    protected:
+    void readPayload(const uint8_t * const payload) override;
+
+    public:
+    uint32_t getITOW();     // ms, GPS time of week of the navigation epoch
+    uint8_t getFixType();   // 0 no fix, 1 dead reckoning, 2 2D, 3 3D, 4 GPS + dead reckoning, 5 time only
+    uint8_t getFlags();     // gpsFixOk (bit 0), diffSoln (bit 1), wknSet (bit 2), towSet (bit 3)
+    bool getFixOK();
+    uint8_t getFixStatus(); // diffCorr (bit 0), carrSolnValid (bit 1), mapMatching (bits 6..7)
+    uint8_t getFlags2();    // psmState (bits 0..1), spoofDetState (bits 3..4), carrSoln (bits 6..7)
+    uint32_t getTTFF();     // ms, the time to first fix, or 0 if there has not been a fix
+    uint32_t getMSSS();     // ms, the time since startup or reset
+};
+
+/**
+ * The class for the UTC time solution message (UBX-NAV-TIMEUTC). The time is decoded in place from the
+ * payload as integers, down to the nanosecond. Only the `TIME` group is decoded when the message is read,
+ * so that the message reaches the same consumers as the NMEA time.
+ */
+class NAV_TIMEUTC : public UBX, public TIME
+{
+    public:
+    NAV_TIMEUTC();
+
+    public:
+    static constexpr SentenceMask acceptedTypes = 0;
+    uint8_t getClass() override {return 0x01;}
+    uint8_t getID() override {return 0x21;}
+
+    protected:
+    void readPayload(const uint8_t * const payload) override;
+
+    public:
+    uint32_t getITOW();             // ms, GPS time of week of the navigation epoch
+    uint32_t getTimeAccuracy();     // ns
+    int32_t getNano();              // ns, fraction of the second (may be negative)
+    uint16_t getYear();
+    uint8_t getMonth();
+    uint8_t getDay();
+    uint8_t getHour();
+    uint8_t getMinute();
+    uint8_t getSecond();
+    uint8_t getValidFlags();        // validTOW (bit 0), validWKN (bit 1), validUTC (bit 2), utcStandard (bits 4..7)
+    bool getValidUTC();
+};
+
+typedef std::variant<
+    std::monostate,
+    NAV_PVT, NAV_DOP, NAV_STATUS, NAV_TIMEUTC
+> MessageStorage;
+
+/**
+ * A UBX message that is verified, classified and read exactly once from a complete frame, mirroring
+ * `ParsedSentence`. The message can then be viewed as any of the `UBX` or `GROUP` types that it belongs
+ * to using `as`. For example, `as<NAV_PVT>()`, `as<POS>()` and `as<TIME>()` all return a view of the same
+ * NAV-PVT message, whereas `as<NAV_DOP>()` returns `NULL`.
+ *
+ * @note The message is held in place within this object, so creating a `ParsedMessage` does not allocate
+ *       any memory. The payload is not copied, so the frame must remain valid for as long as the message
+ *       is used.
+ */
+class ParsedMessage
+{
+    public:
+    ParsedMessage(const uint8_t * const message, uint16_t length);
+    ParsedMessage(const ParsedMessage&) = delete;
+    ParsedMessage& operator=(const ParsedMessage&) = delete;
+
+    Messages getType();
+    UBX * const getMessage();
+    template <typename T> T * const as();
+
+    static Messages classify(uint8_t clazz, uint8_t id);
+
+    private:
+    Messages type = UBX_INV;
+    UBX * message = NULL;
+    MessageStorage storage;
+
+    template <typename T, typename S> T * const project();
+};
+
+/* Include the template implementation after declaration
+ * NOTE: This is done as templates must either be fully defined in the header
+ *       or have specific implementations specified. To circumvent this, a file
+ *       with the template implementation can be included in the header to include
+ *       the implementation. This reduces the code in the header file.
+ * NOTE: Do NOT include ubx.tpp at the beginning of this file or at any point
+ *       in other header files.
+ * REFERENCE: https://stackoverflow.com/questions/495021/why-can-templates-only-be-implemented-in-the-header-file
+ * REFERENCE: https://isocpp.org/wiki/faq/templates#templates-defn-vs-decl
+ */
+#include "ubx.tpp"
+
 #endif
\ No newline at end of file
@@ -0,0 +1,44 @@
+/**
+ * FILE: ubx.tpp
+ * PURPOSE: To serve as the template implementation file for the UBX messages declared in ubx.hpp
+ *
+ * UPDATED: 17 Oct. 2026
+ *
+ * NOTE: Do NOT include this file other than at the end of ubx.hpp.
+ *       Any other includes may lead to issues.
+ */
+
+/* ------------------- ParsedMessage Definitions ------------------------ */
+
+/**
+ * Returns a view of the message as the given type, or NULL if the message does not belong to the type.
+ * `T` may be a message type (eg. `NAV_PVT`) or a `GROUP` type that a message implements (eg. `POS`).
+ */
+template <typename T>
+T * const ParsedMessage::as()
+{
+    switch (this->type)
+    {
+        case UBX_NAV_PVT: return this->project<T, NAV_PVT>();
+        case UBX_NAV_DOP: return this->project<T, NAV_DOP>();
+        case UBX_NAV_STATUS: return this->project<T, NAV_STATUS>();
+        case UBX_NAV_TIMEUTC: return this->project<T, NAV_TIMEUTC>();
+        default: return NULL;
+    }
+}
+
+/* Returns the held message of type `S` as a `T`, or NULL if `S` does not belong to `T` */
+template <typename T, typename S>
+T * const ParsedMessage::project()
+{
+    if constexpr (std::is_base_of_v<T, S>)
+    {
+        return std::get_if<S>(&this->storage);
+    }
+    else
+    {
+        return NULL;
+    }
+}
+
+/* ----------------- End ParsedMessage Definitions ---------------------- */